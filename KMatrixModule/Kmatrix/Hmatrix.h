@@ -5,7 +5,6 @@
 #include "SVD.h"
 #include "LMmin.h"
 #include "ellipse_operations.h"
-#include "jac_eqs.h"
 #include "messager.h"
 #include <vector>
 #include <cmath>
@@ -203,99 +202,58 @@ void jacdif(const vector<T> &P, const std::vector<matrix<T> > &S, matrix<T> &J,
     }
 }
 
+// Jacobian of errorShape() with respect to the entries of H (row-major in P).
+// With G = S*H, the derivative of M = H^t*S*H along H(r,c) is
+// dM(i,j) = G(r,i)*[j==c] + [i==c]*G(r,j); it is propagated through the
+// center formula of getEllipseCenter() and the euclidean distance to (u,v).
 template<typename T>
-class LMhomography : public MinLM<T>
+void jacErrorShape(const vector<T> &P, const matrix<T> &S, T u, T v, matrix<T> &J, int row)
 {
-public:
-    LMhomography(std::vector<matrix<T> > &s, matrix<T> &uv)
-    {
-        S = s;
-        UV = uv;
-    }
-
-private:
-    matrix<T> Hini;
-    std::vector<matrix<T> > S;
-    matrix<T> UV;
-public:
-    virtual void modelData(const vector<T> &P, vector<T> &ymodel) const
-    {
-        int ncircle = ymodel.size();
-        matrix<T> H(3, 3);
-        H(0, 0) = P[0];
-        H(0, 1) = P[1];
-        H(0, 2) = P[2];
-        H(1, 0) = P[3];
-        H(1, 1) = P[4];
-        H(1, 2) = P[5];
-        H(2, 0) = P[6];
-        H(2, 1) = P[7];
-        H(2, 2) = P[8];
-        for (int i = 0; i < ncircle; i++) {
-            T err = errorShape(H, S[i], UV(0, i), UV(1, i));
-            ymodel[i] = err;
-        }
+    T h[9], s[9], g[9];
+    for (int k = 0; k < 9; k++) {
+        h[k] = P[k];
+        s[k] = S(k/3, k%3);
     }
-
-    virtual void modelJacobian(const vector<T> &P, matrix<T> &J) const
-    {
-        // jacdif(P,S,J,UV);
-        int ncircle = J.nrow();
-        for (int i = 0; i < ncircle; i++) {
-            jac_inv_equations(P, S[i], UV(0, i), UV(1, i), J(i, 0), J(i, 1), J(i, 2),
-                              J(i, 3), J(i, 4), J(i, 5), J(i, 6), J(i, 7), J(i, 8));
-        }
-    }
-};
-template<typename T>
-class LMhomography2 : public MinLM<T>
-{
-public:
-    LMhomography2(std::vector<matrix<T> > &s, matrix<T> &uv)
-    {
-        S = s;
-        UV = uv;
+    for (int i = 0; i < 3; i++)
+        for (int j = 0; j < 3; j++)
+            g[3*i+j] = s[3*i]*h[j] + s[3*i+1]*h[3+j] + s[3*i+2]*h[6+j];
+    // M = H^t*G, only the entries used by the center formula
+    T A = h[0]*g[0] + h[3]*g[3] + h[6]*g[6];
+    T B = h[0]*g[1] + h[3]*g[4] + h[6]*g[7];
+    T C = h[1]*g[1] + h[4]*g[4] + h[7]*g[7];
+    T D = h[0]*g[2] + h[3]*g[5] + h[6]*g[8];
+    T E = h[1]*g[2] + h[4]*g[5] + h[7]*g[8];
+    T den = A*C - B*B;
+    T x = (B*E - C*D) / den;
+    T y = (B*D - A*E) / den;
+    T ex = x-u, ey = y-v;
+    T err = std::sqrt(ex*ex + ey*ey);
+    if (err == 0) {
+        for (int k = 0; k < 9; k++)
+            J(row, k) = 0;
+        return;
     }
-
-private:
-    matrix<T> Hini;
-    std::vector<matrix<T> > S;
-    matrix<T> UV;
-public:
-    virtual void modelData(const vector<T> &P, vector<T> &ymodel) const
-    {
-        int ncircle = ymodel.size();
-        matrix<T> H(3, 3);
-        H(0, 0) = P[0];
-        H(0, 1) = P[1];
-        H(0, 2) = P[2];
-        H(1, 0) = P[3];
-        H(1, 1) = P[4];
-        H(1, 2) = P[5];
-        H(2, 0) = P[6];
-        H(2, 1) = P[7];
-        H(2, 2) = P[8];
-        for (int i = 0; i < ncircle; i++) {
-            T err = errorShape(H, S[i], UV(0, i), UV(1, i));
-            ymodel[i] = err;
+    for (int r = 0; r < 3; r++) {
+        const T *gr = g+3*r;
+        for (int c = 0; c < 3; c++) {
+            T dA = (c == 0) ? 2*gr[0] : 0;
+            T dB = ((c == 1) ? gr[0] : 0) + ((c == 0) ? gr[1] : 0);
+            T dC = (c == 1) ? 2*gr[1] : 0;
+            T dD = ((c == 2) ? gr[0] : 0) + ((c == 0) ? gr[2] : 0);
+            T dE = ((c == 2) ? gr[1] : 0) + ((c == 1) ? gr[2] : 0);
+            T dDen = dA*C + A*dC - 2*B*dB;
+            T dx = (dB*E + B*dE - dC*D - C*dD - x*dDen) / den;
+            T dy = (dB*D + B*dD - dA*E - A*dE - y*dDen) / den;
+            J(row, 3*r+c) = (ex*dx + ey*dy) / err;
         }
     }
+}
 
-    virtual void modelJacobian(const vector<T> &P, matrix<T> &J) const
-    {
-        // jacdif(P,S,J,UV);
-        int ncircle = J.nrow();
-        for (int i = 0; i < ncircle; i++) {
-            jac_inv_maple(P, S[i], UV(0, i), UV(1, i), J(i, 0), J(i, 1), J(i, 2),
-                          J(i, 3), J(i, 4), J(i, 5), J(i, 6), J(i, 7), J(i, 8));
-        }
-    }
-};
 template<typename T>
-class LMhomography3 : public MinLM<T>
+class LMhomography : public MinLM<T>
 {
 public:
-    LMhomography3(std::vector<matrix<T> > &s, matrix<T> &uv)
+    LMhomography(std::vector<matrix<T> > &s, matrix<T> &uv)
     {
         S = s;
         UV = uv;
@@ -329,10 +287,8 @@ public:
     {
         // jacdif(P,S,J,UV);
         int ncircle = J.nrow();
-        for (int i = 0; i < ncircle; i++) {
-            jac_inv_maple_noOptimize(P, S[i], UV(0, i), UV(1, i), J(i, 0), J(i, 1), J(i, 2),
-                                     J(i, 3), J(i, 4), J(i, 5), J(i, 6), J(i, 7), J(i, 8));
-        }
+        for (int i = 0; i < ncircle; i++)
+            jacErrorShape(P, S[i], UV(0, i), UV(1, i), J, i);
     }
 };
 #endif
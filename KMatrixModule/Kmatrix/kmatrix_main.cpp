@@ -9,6 +9,14 @@
 
 #include "Hmatrix.h"
 #include "Kmatrix.h"
+// libConcurrent
+#include "abstractthreadpool.h"
+#include "stlCallable.h"
+#include "qthreadpoolbridge.h"
+static concurrent::AbstractThreadPool& DEFAULT_THREAD_POOL = QThreadpoolBridge::DEFAULT;
+
+#include <atomic>
+#include <algorithm>
 
 using namespace libNumerics;
 
@@ -45,9 +53,44 @@ vector<T> mat2vec(const matrix<T> &m, int l)
     return v;
 }
 
+// homographies of one view, filled by refineViewHomography()
+template<typename T>
+struct ViewHomography {
+    std::string log;
+    matrix<T> H_point;
+    matrix<T> H_ellip;
+};
+
+/* Fit the homography of view i from the centers XY of the circles S to the ellipse centers:
+   first on the points, then refined by minimizing the distance between the ellipse centers
+   and the centers of the circles transformed by the homography. */
+template<typename T>
+bool refineViewHomography(std::vector<matrix<T> > *S, matrix<T> *XY, matrix<T> *centers,
+                          T tolFun, int i, ViewHomography<T> *res,
+                          std::atomic_int *progress)
+{
+    libMsg::abortIfAsked();
+    libMsg::CaptureScope capture(res->log);
+    int ncircle = S->size();
+    matrix<T> H_ini;
+    if (!solveHomography(*XY, *centers, H_ini)) return false;
+    res->H_point = H_ini;
+    LMhomography<T> HeLMA(*S, *centers);
+    HeLMA.relativeTol = 1e-9;
+    vector<T> trgData = vector<T>::zeros(ncircle);
+    vector<T> h_ = mat2vec(H_ini.inv(), 9);
+    T rmse_ellip = HeLMA.minimize(h_, trgData, tolFun);
+    res->H_ellip = (vec2mat(h_, 3, 3)).inv();
+    libMsg::cout<<"Image_"<<i<<"\t"<<"Iterations: "<<HeLMA.iterations<<" RMSE_ellipse: "
+                <<rmse_ellip<<libMsg::endl;
+    progress->fetch_add(1, std::memory_order_release);
+    return true;
+}
+
 template<typename T>
 bool extractK_real(std::vector<matrix<T> > &S, std::vector<matrix<T> > &Ellipse_centers, T tolFun,
-                   std::vector<matrix<double> > &CHS, matrix<T> &Kout)
+                   std::vector<matrix<double> > &CHS, matrix<T> &Kout,
+                   concurrent::AbstractThreadPool& pool = DEFAULT_THREAD_POOL)
 {
     int nimage = Ellipse_centers.size();
     int ncircle = S.size();
@@ -63,24 +106,39 @@ bool extractK_real(std::vector<matrix<T> > &S, std::vector<matrix<T> > &Ellipse_
     std::vector<matrix<T> > H_ellip(nimage);
     std::vector<matrix<T> > H_point(nimage);
 
-    // calculate homographies through minimization of d|CHS-CH0S|
+    // calculate homographies through minimization of d|CHS-CH0S|, one task per image
+    std::vector<ViewHomography<T> > views(nimage);
+    std::atomic_int progress;
+    progress.store(0);
+
+    // Lauche MultiTask{
+    std::vector<concurrent::Future<bool>*> ftrs;
+    for (int i = 0; i < nimage; i++)
+        ftrs.push_back(concurrent::asyncInvoke(
+                           pool, &refineViewHomography<T>,
+                           &S, &XY, &Ellipse_centers[i], tolFun, i, &views[i], &progress));
+    // }Lauche MultiTask
+
+    // Report progress and wait for all task to finish
+    concurrent::ReportProgrsAndWaitFtr(progress, nimage, ftrs);
+    libMsg::cout<<libMsg::endl;
+
+    // get futures and handle exceptions in multi-task
+    bool allOk;
+    concurrent::getFtr_CheckExcpt(allOk, ftrs);
+    std::for_each(ftrs.begin(), ftrs.end(), [](concurrent::Future<bool>* ftr){ delete ftr; });
+    libMsg::abortIfAsked();
+
+    for (int i = 0; i < nimage; i++)
+        libMsg::cout<<views[i].log<<libMsg::flush;
+    if (!allOk) return false;
+
     for (int i = 0; i < nimage; i++) {
-        matrix<T> H_ini;
-        if (!solveHomography(XY, Ellipse_centers[i], H_ini)) return false;
-        H_point[i] = H_ini;
-        LMhomography2<T> HeLMA(S, Ellipse_centers[i]);
-        HeLMA.relativeTol = 1e-9;
-        vector<T> trgData = vector<T>::zeros(ncircle);
-        vector<T> h_ = mat2vec(H_ini.inv(), 9);
-        T rmse_ellip = HeLMA.minimize(h_, trgData, tolFun);
-        matrix<T> H_fin = (vec2mat(h_, 3, 3)).inv();
-        H_ellip[i] = H_fin;
-        libMsg::cout<<"Image_"<<i<<"\t"<<"Iterations: "<<HeLMA.iterations<<" RMSE_ellipse: "
-                    <<rmse_ellip<<libMsg::endl;
+        H_point[i] = views[i].H_point;
+        H_ellip[i] = views[i].H_ellip;
         CHS.push_back( matrix<T>::zeros(2, ncircle));
         matrix<T> HCS = matrix<T>::zeros(2, ncircle);
         rotateVirtualImg(S, H_ellip[i], CHS[i], HCS);
-        libMsg::abortIfAsked();
     }
     matrix<T> K_ellip;
     matrix<T> K_point;
@@ -1,153 +1,275 @@
 #include "abberation.h"
 
 #include <iostream>
+#include <algorithm>
 
 #include "messager.h"
-int white_neighbors(const Pixel &p, const ImageGray<BYTE> &img)
+// libConcurrent
+#include "abstractthreadpool.h"
+#include "stlCallable.h"
+//#include "simplethreadpool.h"
+//static concurrent::AbstractThreadPool& DEFAULT_THREAD_POOL = concurrent::SimpleThreadPool::DEFAULT;
+#include "qthreadpoolbridge.h"
+static concurrent::AbstractThreadPool& DEFAULT_THREAD_POOL = QThreadpoolBridge::DEFAULT;
+
+/* Height of the strips of rows labelled in parallel */
+#define CC_STRIP 64
+
+/* Statistics of the pixels of a component that got the same provisional label */
+struct CCPart
 {
-    int nn = 0;
-    Pixel p1(p.x-1, p.y);
-    if (p1.x >= 0 && p1.x < img.xsize() && p1.y >= 0 && p1.y < img.ysize()) {
-        if (img.pixel(p1.x, p1.y) == 255)
-            nn++;
-    } else {
-        nn++;
-    }
+    int nPoints, perimeter;
+    double sumX, sumY;
+    int minX, minY, maxX, maxY;
+    int firstX, firstY; // first pixel met by a column by column scan
+};
 
-    Pixel p2(p.x+1, p.y);
-    if (p2.x >= 0 && p2.x < img.xsize() && p2.y >= 0 && p2.y < img.ysize()) {
-        if (img.pixel(p2.x, p2.y) == 255)
-            nn++;
-    } else {
-        nn++;
-    }
+/* colors of the feedback image */
+enum CCKind { CC_SMALL, CC_NOT_CIRCLE, CC_CIRCLE, CC_FILTERED };
 
-    Pixel p3(p.x, p.y-1);
-    if (p3.x >= 0 && p3.x < img.xsize() && p3.y >= 0 && p3.y < img.ysize()) {
-        if (img.pixel(p3.x, p3.y) == 255)
-            nn++;
-    } else {
-        nn++;
+static int findRoot(std::vector<int> &parent, int l)
+{
+    while (parent[l] != l) {
+        parent[l] = parent[parent[l]];
+        l = parent[l];
     }
+    return l;
+}
+
+static void unionLabels(std::vector<int> &parent, int a, int b)
+{
+    a = findRoot(parent, a);
+    b = findRoot(parent, b);
+    if (a < b) parent[b] = a;
+    else if (b < a) parent[a] = b;
+}
 
-    Pixel p4(p.x, p.y+1);
-    if (p4.x >= 0 && p4.x < img.xsize() && p4.y >= 0 && p4.y < img.ysize()) {
-        if (img.pixel(p4.x, p4.y) == 255)
-            nn++;
-    } else {
-        nn++;
+static void addPart(CCPart &to, const CCPart &from)
+{
+    to.nPoints += from.nPoints;
+    to.perimeter += from.perimeter;
+    to.sumX += from.sumX;
+    to.sumY += from.sumY;
+    to.minX = std::min(to.minX, from.minX);
+    to.minY = std::min(to.minY, from.minY);
+    to.maxX = std::max(to.maxX, from.maxX);
+    to.maxY = std::max(to.maxY, from.maxY);
+    if (from.firstX < to.firstX || (from.firstX == to.firstX && from.firstY < to.firstY)) {
+        to.firstX = from.firstX;
+        to.firstY = from.firstY;
     }
+}
 
-    if (nn > 0) nn = 1;
-    return nn;
+/* Is the pixel (x,y) outside of the image or white? */
+static inline bool whiteOrOutside(const ImageBit &img, int x, int y)
+{
+    return !img.pixelInside(x, y) || !img.pixel(x, y);
 }
 
-void extract_CCStats(std::vector<Pixel> &cc, CCStats &stats, const ImageGray<BYTE> &img)
+/*
+ * First pass of the labelling on the rows [y0,y1): black pixels get a provisional
+ * label of the strip, 4-connected labels are merged in 'parent', and the statistics
+ * of each label are gathered in 'parts'. Labels start at 1, 0 is the background.
+ */
+static void labelStrip(const ImageBit *img, ImageGray<int> *labels, int y0, int y1,
+                       std::vector<int> *parent, std::vector<CCPart> *parts)
 {
-    stats.nPoints = cc.size();
-    stats.perimeter = 0;
-    double meanX = 0, meanY = 0;
-    double minX = img.xsize(), minY = img.ysize(), maxX = 0, maxY = 0;
-    for (int i = 0; i < cc.size(); i++) {
-        meanX += cc[i].x;
-        meanY += cc[i].y;
-        if (cc[i].x > maxX) maxX = cc[i].x;
-        if (cc[i].x < minX) minX = cc[i].x;
-        if (cc[i].y > maxY) maxY = cc[i].y;
-        if (cc[i].y < minY) minY = cc[i].y;
-        stats.perimeter += white_neighbors(Pixel(cc[i].x, cc[i].y), img);
+    int w = img->xsize();
+    parent->assign(1, 0);
+    parts->assign(1, CCPart());
+    for (int y = y0; y < y1; y++) {
+        const uint64_t *bits = img->row(y);
+        for (int x = 0; x < w; x++) {
+            uint64_t word = bits[x>>6];
+            if (word == 0) {
+                // 64 white pixels at once
+                int xend = std::min((x|63)+1, w);
+                std::fill(&labels->pixel(x, y), &labels->pixel(x, y)+(xend-x), 0);
+                x = xend-1;
+                continue;
+            }
+            if (!((word >> (x&63)) & 1)) {
+                labels->pixel(x, y) = 0;
+                continue;
+            }
+            int left = x > 0 ? labels->pixel(x-1, y) : 0;
+            int up = y > y0 ? labels->pixel(x, y-1) : 0;
+            int l;
+            if (left && up) {
+                l = left;
+                if (left != up) unionLabels(*parent, left, up);
+            } else if (left || up) {
+                l = left ? left : up;
+            } else {
+                l = parent->size();
+                parent->push_back(l);
+                CCPart part = {0, 0, 0, 0, x, y, x, y, x, y};
+                parts->push_back(part);
+            }
+            labels->pixel(x, y) = l;
+            CCPart &part = (*parts)[l];
+            part.nPoints++;
+            part.sumX += x;
+            part.sumY += y;
+            part.minX = std::min(part.minX, x);
+            part.maxX = std::max(part.maxX, x);
+            part.maxY = y;
+            if (x < part.firstX) {
+                part.firstX = x;
+                part.firstY = y;
+            }
+            // a pixel with a white 4-neighbor is on the perimeter
+            if (whiteOrOutside(*img, x-1, y) || whiteOrOutside(*img, x+1, y)
+                || whiteOrOutside(*img, x, y-1) || whiteOrOutside(*img, x, y+1))
+                part.perimeter++;
+        }
     }
-    stats.centerX = meanX / cc.size();
-    stats.centerY = meanY / cc.size();
-    stats.radius1 = 0.5 * (maxX - minX);
-    stats.radius2 = 0.5 * (maxY - minY);
 }
 
-int extract_cc_(Pixel p, std::vector<Pixel> &cc, ImageGray<BYTE> &img)
+/* Feedback colors of the rows [y0,y1), 'kind' is indexed by the global labels */
+static void paintStrip(const ImageGray<int> *labels, int y0, int y1, int offset,
+                       const std::vector<int> *kind, ImageRGB<BYTE> *imgFeedback)
 {
-    std::stack<Pixel> s;
-    BYTE *pColor;
-    if (img.pixelInside(p.x, p.y))
-        pColor = &img.pixel(p.x, p.y);
-    else
-        return 0;
-    while (*pColor == 0 || !s.empty())
-    {
-        if (*pColor == 0) {
-            cc.push_back(p);
-            *pColor = 255;
-            s.push(Pixel(p.x+1, p.y));
-            s.push(Pixel(p.x-1, p.y));
-            s.push(Pixel(p.x, p.y+1));
-            s.push(Pixel(p.x, p.y-1));
+    static const BYTE colors[4][3] = {
+        {0, 150, 0},   // green means it's too small
+        {150, 0, 0},   // red means it's not a circle
+        {0, 0, 0},     // black means detected
+        {0, 0, 150}    // blue means filtered
+    };
+    int w = labels->xsize();
+    for (int y = y0; y < y1; y++) {
+        for (int x = 0; x < w; x++) {
+            int l = labels->pixel(x, y);
+            if (l == 0) continue;
+            const BYTE *c = colors[(*kind)[offset + l]];
+            imgFeedback->pixel_R(x, y) = c[0];
+            imgFeedback->pixel_G(x, y) = c[1];
+            imgFeedback->pixel_B(x, y) = c[2];
         }
-        p = s.top();
-        s.pop();
-        if (img.pixelInside(p.x, p.y))
-            pColor = &img.pixel(p.x, p.y);
-        else
-            *pColor = 255;
     }
-    return cc.size();
 }
 
-bool CC(std::vector<CCStats> &ccstats, const ImageGray<BYTE> &imgbi, ImageRGB<BYTE> &imgFeedback)
+/*
+ * Draw the components on the feedback image, the kind of a component is the one
+ * of its index in 'compKind', 'comp' gives the component of each global label.
+ */
+static void paintComponents(const ImageGray<int> &labels, const std::vector<int> &offsets,
+                            const std::vector<int> &comp, const std::vector<int> &compKind,
+                            ImageRGB<BYTE> &imgFeedback)
+{
+    const int strip = CC_STRIP;
+    int he = labels.ysize();
+    std::vector<int> kind(comp.size(), CC_SMALL);
+    for (int g = 1; g < comp.size(); g++)
+        kind[g] = compKind[comp[g]];
+    std::vector<concurrent::Future<void>*> ftrs;
+    for (int y = 0, s = 0; y < he; y += strip, s++)
+        ftrs.push_back(concurrent::asyncInvoke(DEFAULT_THREAD_POOL, &paintStrip,
+                                               (const ImageGray<int> *)&labels, y,
+                                               std::min(y+strip, he), offsets[s],
+                                               (const std::vector<int> *)&kind, &imgFeedback));
+    bool allOk;
+    concurrent::getFtr_CheckExcpt(allOk, ftrs);
+    std::for_each(ftrs.begin(), ftrs.end(), [](concurrent::Future<void>* ftr){ delete ftr; });
+    if (!allOk)
+        libMsg::error("CC: a feedback task failed.");
+}
+
+/*
+ * Connected components of the set (black) pixels of 'imgbi' (4-connectivity), by a two pass
+ * union-find labelling on strips of rows. The components come in the order of a column
+ * by column scan of the image.
+ */
+bool CC(std::vector<CCStats> &ccstats, const ImageBit &imgbi, ImageRGB<BYTE> &imgFeedback)
 {
-    ImageGray<BYTE> img_copy(imgbi);
-    std::vector<Pixel> firstPixels;
+    const int strip = CC_STRIP;
+    int wi = imgbi.xsize(), he = imgbi.ysize();
+    int nStrips = (he + strip-1) / strip;
+    ImageGray<int> labels(wi, he);
+    std::vector<std::vector<int> > parents(nStrips);
+    std::vector<std::vector<CCPart> > parts(nStrips);
+
+    // first pass, each strip on its own
+    std::vector<concurrent::Future<void>*> ftrs;
+    for (int s = 0; s < nStrips; s++)
+        ftrs.push_back(concurrent::asyncInvoke(DEFAULT_THREAD_POOL, &labelStrip, &imgbi, &labels,
+                                               s*strip, std::min((s+1)*strip, he),
+                                               &parents[s], &parts[s]));
+    bool allOk;
+    concurrent::getFtr_CheckExcpt(allOk, ftrs);
+    std::for_each(ftrs.begin(), ftrs.end(), [](concurrent::Future<void>* ftr){ delete ftr; });
+    if (!allOk)
+        libMsg::error("CC: a labelling task failed.");
+
+    // global labels: the labels of strip s follow the ones of the previous strips
+    std::vector<int> offsets(nStrips+1, 0);
+    for (int s = 0; s < nStrips; s++)
+        offsets[s+1] = offsets[s] + (int)parents[s].size()-1;
+    std::vector<int> parent(offsets[nStrips]+1, 0);
+    for (int s = 0; s < nStrips; s++)
+        for (int l = 1; l < parents[s].size(); l++)
+            parent[offsets[s]+l] = offsets[s]+parents[s][l];
+    // merge the labels across the strip borders
+    for (int s = 1; s < nStrips; s++) {
+        int y = s*strip;
+        for (int x = 0; x < wi; x++) {
+            int up = labels.pixel(x, y-1), down = labels.pixel(x, y);
+            if (up && down)
+                unionLabels(parent, offsets[s-1]+up, offsets[s]+down);
+        }
+    }
+
+    // second pass on the labels: statistics of each component, then their order
+    std::vector<int> comp(parent.size(), -1);
+    std::vector<CCPart> comps;
+    for (int s = 0; s < nStrips; s++)
+        for (int l = 1; l < parents[s].size(); l++) {
+            int root = findRoot(parent, offsets[s]+l);
+            if (comp[root] < 0) {
+                comp[root] = comps.size();
+                comps.push_back(parts[s][l]);
+            } else {
+                addPart(comps[comp[root]], parts[s][l]);
+            }
+        }
+    for (int g = 1; g < parent.size(); g++)
+        comp[g] = comp[findRoot(parent, g)];
+    std::vector<int> order(comps.size());
+    for (int i = 0; i < order.size(); i++) order[i] = i;
+    std::sort(order.begin(), order.end(), [&comps](int a, int b) {
+        return comps[a].firstX < comps[b].firstX
+               || (comps[a].firstX == comps[b].firstX && comps[a].firstY < comps[b].firstY);
+    });
+
+    std::vector<int> compKind(comps.size(), CC_SMALL);
+    std::vector<int> ccComp; // component of each of the 'ccstats'
     double meansize = 0;
-    for (int i = 0; i < imgbi.xsize(); i++) {
-        for (int j = 0; j < imgbi.ysize(); j++) {
-            std::vector<Pixel> ccC;
+    for (int i = 0; i < order.size(); i++) {
+        const CCPart &part = comps[order[i]];
+        if (part.nPoints > 180) {
             CCStats stats;
-            int npix = extract_cc_(Pixel(i, j), ccC, img_copy);
-            if (npix > 180) {
-                extract_CCStats(ccC, stats, imgbi);
-                double compactness = 4*PI*stats.nPoints / (stats.perimeter*stats.perimeter);
-                // !!compactness < 1.3 is not a good limit! I changed to 1.5 -Leman
-                if (std::min(stats.radius1,
-                             stats.radius2) > 8 && compactness < 1.5 && compactness > 0.7) {
-                    ccstats.push_back(stats);
-                    firstPixels.push_back(Pixel(i, j));
-                    meansize += stats.nPoints;
-                    // draw Feedback
-                    for (int k = 0; k < ccC.size(); ++k) {
-                        Pixel p = ccC[k];
-                        // black means detected
-                        imgFeedback.pixel_R(p.x, p.y) = 0;
-                        imgFeedback.pixel_G(p.x, p.y) = 0;
-                        imgFeedback.pixel_B(p.x, p.y) = 0;
-                    }
-                } else {
-                    // draw Feedback
-                    for (int k = 0; k < ccC.size(); ++k) {
-                        Pixel p = ccC[k];
-                        // red means it's not a circle
-                        imgFeedback.pixel_R(p.x, p.y) = 150;
-                        imgFeedback.pixel_G(p.x, p.y) = 0;
-                        imgFeedback.pixel_B(p.x, p.y) = 0;
-                    }
-                }
+            stats.nPoints = part.nPoints;
+            stats.perimeter = part.perimeter;
+            stats.centerX = part.sumX / part.nPoints;
+            stats.centerY = part.sumY / part.nPoints;
+            stats.radius1 = 0.5 * (part.maxX - part.minX);
+            stats.radius2 = 0.5 * (part.maxY - part.minY);
+            double compactness = 4*PI*stats.nPoints / (stats.perimeter*stats.perimeter);
+            // !!compactness < 1.3 is not a good limit! I changed to 1.5 -Leman
+            if (std::min(stats.radius1,
+                         stats.radius2) > 8 && compactness < 1.5 && compactness > 0.7) {
+                ccstats.push_back(stats);
+                ccComp.push_back(order[i]);
+                meansize += stats.nPoints;
+                compKind[order[i]] = CC_CIRCLE;
             } else {
-                // draw Feedback
-                for (int k = 0; k < ccC.size(); ++k) {
-                    Pixel p = ccC[k];
-                    // green means it's too small
-                    imgFeedback.pixel_R(p.x, p.y) = 0;
-                    imgFeedback.pixel_G(p.x, p.y) = 150;
-                    imgFeedback.pixel_B(p.x, p.y) = 0;
-                }
+                compKind[order[i]] = CC_NOT_CIRCLE;
             }
         }
-        double percent = ((double)i / (double)imgbi.xsize())*100;
-        if (!(i % (int)(0.2*imgbi.xsize()+1)))
-            libMsg::cout<<(int)(percent+1)<<'%'<<libMsg::flush;
-        else if (!(i % (int)(0.04*imgbi.xsize()+1)))
-            libMsg::cout<<'.'<<libMsg::flush;
     }
-    libMsg::cout<<libMsg::endl;
 
     if (ccstats.size() == 0) {
+        paintComponents(labels, offsets, comp, compKind, imgFeedback);
         libMsg::cout<<"Nothing interesting found in this image. Please check.";
         return false;
     }
@@ -231,14 +353,14 @@ bool CC(std::vector<CCStats> &ccstats, const ImageGray<BYTE> &imgbi, ImageRGB<BY
     }
 
     std::vector<CCStats> erasedCCStats;
-    std::vector<int> outliersIdx;
     int idx = 0;
     while (idx < ccstats.size()) {
         if (inliers[idx] == 0) {
             erasedCCStats.push_back(ccstats[idx]);
-            outliersIdx.push_back(idx);
+            compKind[ccComp[idx]] = CC_FILTERED;
             ccstats.erase(ccstats.begin() + idx);
             inliers.erase(inliers.begin() + idx);
+            ccComp.erase(ccComp.begin() + idx);
         } else {
             idx++;
         }
@@ -246,24 +368,13 @@ bool CC(std::vector<CCStats> &ccstats, const ImageGray<BYTE> &imgbi, ImageRGB<BY
     libMsg::cout<<"Region found after filter: [ "<<ccstats.size()<<" ]"<<libMsg::endl;
     if (erasedCCStats.size() > 0) {
         libMsg::cout<<"Erased circles:"<<libMsg::endl;
-        ImageGray<BYTE> img_copy2(imgbi);
         for (int i = 0; i < erasedCCStats.size(); ++i) {
             CCStats &stats = erasedCCStats[i];
             libMsg::cout<<"circle "<<i<<libMsg::endl;
             libMsg::cout<<"\tarea: "<<stats.nPoints<<libMsg::endl;
             libMsg::cout<<"\tcenter: "<<stats.centerX<<", "<<stats.centerY<<libMsg::endl;
-            int index = outliersIdx[i];
-            Pixel first = firstPixels[index];
-            std::vector<Pixel> ccC;
-            extract_cc_(first, ccC, img_copy2);
-            for (int k = 0; k < ccC.size(); ++k) {
-                Pixel p = ccC[k];
-                // blue means filtered
-                imgFeedback.pixel_R(p.x, p.y) = 0;
-                imgFeedback.pixel_G(p.x, p.y) = 0;
-                imgFeedback.pixel_B(p.x, p.y) = 150;
-            }
         }
     }
+    paintComponents(labels, offsets, comp, compKind, imgFeedback);
     return true;
 }
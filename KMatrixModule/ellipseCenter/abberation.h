@@ -8,15 +8,6 @@
 
 #define PI 3.14159265358979323
 
-class Pixel
-{
-public: int x, y;
-    Pixel(int X, int Y)
-    {
-        x = X, y = Y;
-    }
-};
-
 class CCStats
 {
 public:
@@ -24,14 +15,8 @@ public:
     double centerX, centerY, radius1, radius2;
     int perimeter; // need to calculate compactness measure of shape to eliminate noise
 };
-// Leman: const Pixel& p
-int white_neighbors(const Pixel &p,const ImageGray<BYTE> &img);
-
-void extract_CCStats(std::vector<Pixel> &cc, CCStats &stats, const ImageGray<BYTE> &img);
-
-int extract_cc_(Pixel p, std::vector<Pixel> &cc, ImageGray<BYTE> &img);
 
-bool CC(std::vector<CCStats> &ccstats, const ImageGray<BYTE> &imgbi, ImageRGB<BYTE> &imgFeedback);
+bool CC(std::vector<CCStats> &ccstats, const ImageBit &imgbi, ImageRGB<BYTE> &imgFeedback);
 
 // finds corresponding circle center match among two channels
 template<typename T>
@@ -2,6 +2,7 @@
 #define CENTERS_H
 
 #include "LMmin.h"
+#include <algorithm>
 // #include "pgm_io.h"
 
 template<typename T>
@@ -362,4 +363,267 @@ public:
     }
 };
 
+/* Same fit as LMTacheC, with the steps of libNumerics::MinLM::minimize(), on the 9 parameters
+   model_luminance_alternative() depends on (P[5], P[7] and P[11] are left untouched). J^tJ and
+   J^tE are summed pixel by pixel in fixed size arrays, so the iterations allocate nothing */
+template<typename T>
+class LMTacheFast
+{
+public:
+    LMTacheFast(T cx, T cy, T delta, bool tache_color, int img_width, int img_height)
+        : iterations(0),
+        relativeTol(libNumerics::DEFAULT_RELATIVE_TOL),
+        lambdaInit(libNumerics::DEFAULT_LAMBDA_INIT),
+        lambdaFact(libNumerics::DEFAULT_LAMBDA_FACT)
+    {
+        clr = tache_color;
+        wi = img_width;
+        he = img_height;
+        xbegin = cx+0.5-delta;
+        xend = cx+0.5+delta;
+        ybegin = cy+0.5-delta;
+        yend = cy+0.5+delta;
+    }
+
+    /// Same meaning and return value as MinLM::minimize(), yData is the window in the order of
+    /// trgtDataCalc()
+    T minimize(libNumerics::vector<T> &P, const libNumerics::vector<T> &yData,
+               T targetRMSE = 0.1, int maxIters = 300)
+    {
+        int n = yData.nrow();
+        T sqErrorMax_n = targetRMSE * targetRMSE * n;
+        // the model is constant out of the image, its error there is summed once
+        outSqError = 0;
+        int idx = 0;
+        for (int v = ybegin; v <= yend; v++)
+            for (int u = xbegin; u <= xend; u++, idx++)
+                if (!(u >= 1 && u <= wi-2 && v >= 1 && v <= he-2)) {
+                    T e = yData[idx] - (clr ? 0 : 255);
+                    outSqError += e*e;
+                }
+        T p[NPARAM], tryP[NPARAM], JtJ[NPARAM][NPARAM], B[NPARAM];
+        T tryJtJ[NPARAM][NPARAM], tryB[NPARAM];
+        for (int k = 0; k < NPARAM; k++)
+            p[k] = P[PARAM[k]];
+        T sqError_n = normalEquations(p, yData, JtJ, B);
+        T sqRelativeTolUp = (1+relativeTol)*(1+relativeTol);
+        T sqRelativeTolDown = (1-relativeTol)*(1-relativeTol);
+        T lambda = lambdaInit;
+        for (iterations = 0; iterations < maxIters && sqError_n > sqErrorMax_n; iterations++) {
+            T H[NPARAM][NPARAM], dP[NPARAM];
+            for (int i = 0; i < NPARAM; i++) {
+                for (int j = 0; j < NPARAM; j++)
+                    H[i][j] = JtJ[i][j];
+                H[i][i] *= 1 + lambda;
+                dP[i] = B[i];
+            }
+            T trySqError_n = 0;
+            if (solve(H, dP)) {
+                for (int k = 0; k < NPARAM; k++)
+                    tryP[k] = p[k] + dP[k];
+                // the normal equations of the next step come with the error
+                trySqError_n = normalEquations(tryP, yData, tryJtJ, tryB);
+            } else {
+                trySqError_n = 2*sqError_n;
+            }
+            T sqRatio = trySqError_n/sqError_n;
+            if (sqRatio <= sqRelativeTolUp && sqRatio >= sqRelativeTolDown)
+                break;
+            if (trySqError_n > sqError_n) {
+                lambda *= lambdaFact;
+            } else {
+                lambda /= lambdaFact;
+                sqError_n = trySqError_n;
+                for (int i = 0; i < NPARAM; i++) {
+                    p[i] = tryP[i];
+                    B[i] = tryB[i];
+                    for (int j = 0; j < NPARAM; j++)
+                        JtJ[i][j] = tryJtJ[i][j];
+                }
+            }
+        }
+        for (int k = 0; k < NPARAM; k++)
+            P[PARAM[k]] = p[k];
+        return std::sqrt(sqError_n/n);
+    }
+
+    int iterations;
+    T relativeTol;
+    T lambdaInit;
+    T lambdaFact;
+
+private:
+    enum { NPARAM = 9 };
+    // index in P of l1, l2, theta, tu, tv, p, vh, vb, c
+    static const int PARAM[NPARAM];
+    bool clr;
+    int wi, he;
+    int xbegin, xend, ybegin, yend;
+    T outSqError;
+
+    /// The parameters, and the values all pixels share, for one evaluation of the model
+    struct Model
+    {
+        Model(const T *p)
+            : l1(p[0]), l2(p[1]), tu(p[3]), tv(p[4]), slope(p[5]), vh(p[6]), vb(p[7]), c(p[8]),
+            cosT(std::cos(p[2])), sinT(std::sin(p[2])), x20(-1.0/p[5]), x10(1.0/p[5]),
+            s(0.5*(p[6]-p[7])) {}
+        T l1, l2, tu, tv, slope, vh, vb, c;
+        T cosT, sinT, x20, x10, s;
+    };
+
+    /// Luminance of model_luminance_alternative() at (u,v) inside the image, and its derivatives in
+    /// J if not null
+    inline T pixel(const Model &m, int u, int v, T *J) const
+    {
+        T X = (u-m.tu)*m.cosT - (v-m.tv)*m.sinT;
+        T Y = (u-m.tu)*m.sinT + (v-m.tv)*m.cosT;
+        T x = m.l1*X, y = m.l2*Y;
+        T dist = x*x + y*y;
+        if (!(dist < 2.0*2.0)) { // does not belong to circle
+            if (J)
+                for (int k = 0; k < NPARAM; k++)
+                    J[k] = 0;
+            return clr ? 0 : 255;
+        }
+        T norm = std::sqrt(dist);
+        T d = clr ? norm-m.c : m.c-norm;
+        T s2;
+        if (d >= m.x20)
+            s2 = 0;
+        else if (d <= m.x10)
+            s2 = 1;
+        else
+            s2 = 0.5*(m.slope*d)+0.5;
+        if (J) {
+            if (d < m.x20 && d > m.x10) {
+                T k = m.s*m.slope/norm;
+                J[0] = -k*x*X;
+                J[1] = -k*y*Y;
+                J[2] = -k*X*Y*(m.l2*m.l2-m.l1*m.l1);
+                J[3] = k*(x*m.l1*m.cosT + y*m.l2*m.sinT);
+                J[4] = -k*(x*m.l1*m.sinT - y*m.l2*m.cosT);
+                J[5] = clr ? -m.s*d : m.s*d;
+                J[8] = m.s*m.slope;
+            } else {
+                for (int k = 0; k < 6; k++)
+                    J[k] = 0;
+                J[8] = 0;
+            }
+            J[6] = clr ? 1-s2 : s2;
+            J[7] = clr ? s2 : 1-s2;
+        }
+        T lum = s2 * (m.vh - m.vb);
+        return clr ? m.vh - lum : m.vb + lum;
+    }
+
+    /// Fill J^tJ and J^tE at p, return |E|^2
+    T normalEquations(const T *p, const libNumerics::vector<T> &yData, T JtJ[NPARAM][NPARAM],
+                      T B[NPARAM]) const
+    {
+        Model m(p);
+        for (int i = 0; i < NPARAM; i++) {
+            B[i] = 0;
+            for (int j = 0; j < NPARAM; j++)
+                JtJ[i][j] = 0;
+        }
+        T sq = outSqError, J[NPARAM];
+        int stride = xend-xbegin+1;
+        for (int v = std::max(ybegin, 1); v <= std::min(yend, he-2); v++) {
+            int idx = (v-ybegin)*stride + std::max(xbegin, 1)-xbegin;
+            for (int u = std::max(xbegin, 1); u <= std::min(xend, wi-2); u++, idx++) {
+                T e = yData[idx] - pixel(m, u, v, J);
+                sq += e*e;
+                for (int i = 0; i < NPARAM; i++) {
+                    if (J[i] == 0) continue;
+                    B[i] += J[i]*e;
+                    for (int j = i; j < NPARAM; j++)
+                        JtJ[i][j] += J[i]*J[j];
+                }
+            }
+        }
+        for (int i = 0; i < NPARAM; i++)
+            for (int j = 0; j < i; j++)
+                JtJ[i][j] = JtJ[j][i];
+        return sq;
+    }
+
+    /// Replace X by H^{-1}X as solveLU(), leaving out the parameters with a null column in J
+    /// like MinLM::compress()
+    static bool solve(T H[NPARAM][NPARAM], T X[NPARAM])
+    {
+        T kernel = 0;
+        for (int i = 0; i < NPARAM; i++)
+            if (H[i][i] > kernel)
+                kernel = H[i][i];
+        kernel *= libNumerics::EPSILON_KERNEL;
+        int used[NPARAM], n = 0;
+        for (int i = 0; i < NPARAM; i++)
+            if (H[i][i] > kernel)
+                used[n++] = i;
+        T A[NPARAM][NPARAM], Y[NPARAM], rowscale[NPARAM];
+        int permut[NPARAM];
+        for (int i = 0; i < n; i++) {
+            for (int j = 0; j < n; j++)
+                A[i][j] = H[used[i]][used[j]];
+            Y[i] = X[used[i]];
+        }
+        for (int i = 0; i < n; i++) {
+            T max = 0.0;
+            for (int j = 0; j < n; j++)
+                if (libNumerics::ABS(A[i][j]) > max)
+                    max = libNumerics::ABS(A[i][j]);
+            if (max == 0.0)
+                return false;
+            rowscale[i] = 1.0/max;
+        }
+        for (int k = 0; k < n; k++) {
+            T max = rowscale[k]*libNumerics::ABS(A[k][k]);
+            int imax = k;
+            for (int i = k+1; i < n; i++) {
+                T tmp = rowscale[i]*libNumerics::ABS(A[i][k]);
+                if (tmp > max) {
+                    max = tmp;
+                    imax = i;
+                }
+            }
+            if (max == 0.0)
+                return false;
+            if (k != imax) {
+                for (int j = 0; j < n; j++)
+                    std::swap(A[k][j], A[imax][j]);
+                rowscale[imax] = rowscale[k];
+            }
+            permut[k] = imax;
+            T Akk = 1/A[k][k];
+            for (int i = k+1; i < n; i++) {
+                T tmp = A[i][k] *= Akk;
+                for (int j = k+1; j < n; j++)
+                    A[i][j] -= tmp*A[k][j];
+            }
+        }
+        for (int k = 0; k < n; k++) {
+            T sum = Y[permut[k]];
+            Y[permut[k]] = Y[k];
+            for (int j = 0; j < k; j++)
+                sum -= A[k][j]*Y[j];
+            Y[k] = sum;
+        }
+        for (int k = n - 1; k >= 0; k--) {
+            T sum = Y[k];
+            for (int j = k+1; j < n; j++)
+                sum -= A[k][j]*Y[j];
+            Y[k] = sum/A[k][k];
+        }
+        for (int i = 0; i < NPARAM; i++)
+            X[i] = 0;
+        for (int i = 0; i < n; i++)
+            X[used[i]] = Y[i];
+        return true;
+    }
+};
+
+template<typename T>
+const int LMTacheFast<T>::PARAM[LMTacheFast<T>::NPARAM] = {0, 1, 2, 3, 4, 6, 8, 9, 10};
+
 #endif
@@ -23,24 +23,39 @@ static concurrent::AbstractThreadPool& DEFAULT_THREAD_POOL = QThreadpoolBridge::
 
 #include <atomic>
 #include <algorithm>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
 using namespace libNumerics;
-void average_image(const ImageGray<double> &img, ImageGray<double> &img_avg)
+/* Summed-area table of img: sat.pixel(x, y) is the sum of the pixels of img in [0,x[ x [0,y[ */
+void summed_area_table(const ImageGrayView<double> &img, ImageGray<double> &sat)
 {
     int w = img.xsize();
     int h = img.ysize();
-    img_avg.resize(img.xsize(), img.ysize());
-    for (int v = 1; v < h-1; v++) {
-        for (int u = 1; u < w-1; u++) {
-            double pix = img.pixel(u-1, v-1) + img.pixel(u, v-1) + img.pixel(u+1, v-1)
-                         +img.pixel(u-1, v) + img.pixel(u, v) + img.pixel(u+1, v)
-                         +img.pixel(u-1, v+1) + img.pixel(u, v+1) + img.pixel(u+1, v+1);
-            img_avg.pixel(u, v) = pix/9;
+    sat.resize(w+1, h+1);
+    for (int u = 0; u <= w; u++)
+        sat.pixel(u, 0) = 0;
+    for (int v = 0; v < h; v++) {
+        double rowSum = 0;
+        sat.pixel(0, v+1) = 0;
+        for (int u = 0; u < w; u++) {
+            rowSum += img.pixel(u, v);
+            sat.pixel(u+1, v+1) = sat.pixel(u+1, v) + rowSum;
         }
     }
 }
 
+/* Mean of the (2*radius+1)^2 box centered on pixel (u,v), from the summed-area table of the
+   image, the box must lie in the image */
+inline double box_mean(const ImageGray<double> &sat, int u, int v, int radius)
+{
+    int side = 2*radius+1;
+    return (sat.pixel(u+radius+1, v+radius+1) - sat.pixel(u-radius, v+radius+1)
+            - sat.pixel(u+radius+1, v-radius) + sat.pixel(u-radius, v-radius)) / (side*side);
+}
+
 template<typename T>
-bool initial_tache(const ImageGray<double> &I, vector<T> &h, T &rayon, bool color, T x, T y)
+bool initial_tache(const ImageGrayView<double> &I, vector<T> &h, T &rayon, bool color, T x, T y)
 {
     int COL_IMA = I.xsize();
     int LIG_IMA = I.ysize();
@@ -135,10 +150,8 @@ bool initial_tache(const ImageGray<double> &I, vector<T> &h, T &rayon, bool colo
             labelmin = k;
         }
     }
-    if (labelmin == 0) {
-        libMsg::cout<<"region too small (<=25 pixels)\n"<<libMsg::endl;
+    if (labelmin == 0) /* region too small (<=25 pixels) */
         return false;
-    }
     x = bary(labelmin, 0)/bary(labelmin, 2);
     y = bary(labelmin, 1)/bary(labelmin, 2);
     T sx2 = 0, sy2 = 0, sxy = 0, ss = 0;
@@ -172,7 +185,7 @@ bool initial_tache(const ImageGray<double> &I, vector<T> &h, T &rayon, bool colo
 }
 
 template<typename T>
-bool initial_tache_center(const ImageGray<double> &I, double &centerX, double &centerY, T &rayon,
+bool initial_tache_center(const ImageGrayView<double> &I, double &centerX, double &centerY, T &rayon,
                           bool color, T x, T y)
 {
     int COL_IMA = I.xsize();
@@ -242,8 +255,9 @@ bool initial_tache_center(const ImageGray<double> &I, double &centerX, double &c
     return true;
 }
 
+// the 3x3 averages of the sub image at the pixels of the fit window, from its summed-area table
 template<typename T>
-vector<T> trgtDataCalc(ImageGray<double> &img_avg, T cx, T cy, T delta)
+vector<T> trgtDataCalc(const ImageGray<double> &sat, T cx, T cy, T delta)
 {
     int xbegin = cx+0.5-delta;
     int xend = cx+0.5+delta;
@@ -251,13 +265,13 @@ vector<T> trgtDataCalc(ImageGray<double> &img_avg, T cx, T cy, T delta)
     int yend = cy+0.5+delta;
     int nerr = (yend-ybegin+1)*(xend-xbegin+1);
     vector<T> trgData = vector<T>::zeros(nerr);
-    int wi = img_avg.xsize();
-    int he = img_avg.ysize();
+    int wi = sat.xsize()-1;
+    int he = sat.ysize()-1;
     int idx = 0;
     for (int v = ybegin; v <= yend; v++) {
         for (int u = xbegin; u <= xend; u++) {
             if (u >= 1 && u <= wi-2 && v >= 1 && v <= he-2)
-                trgData[idx] = img_avg.pixel(u, v);
+                trgData[idx] = box_mean(sat, u, v, 1);
             else
                 trgData[idx] = 255; // for 'tache noire'
             idx++;
@@ -267,34 +281,33 @@ vector<T> trgtDataCalc(ImageGray<double> &img_avg, T cx, T cy, T delta)
 }
 
 template<typename T>
-bool centerLMA(const ImageGray<double> &sub_img, bool clr, T &centerX, T &centerY, vector<T> &Pout)
+bool centerLMA(const ImageGrayView<double> &sub_img, ImageGray<double> &sat, bool clr, T &centerX,
+               T &centerY, vector<T> &Pout)
 {
-    ImageGray<double> img_avg;
-    average_image(sub_img, img_avg);
+    summed_area_table(sub_img, sat);
     int w = sub_img.xsize();
     int h = sub_img.ysize();
     T cx = w/2, cy = h/2, radi = 0.4*w;
     vector<T> P(12);
     if (!initial_tache(sub_img, P, radi, clr, cx, cy)) return false;
-    vector<T> trgData = trgtDataCalc<T>(img_avg, P[3], P[4], radi*2);
-    LMTacheC<T> ellipseLMA(img_avg, P[3], P[4], radi*2, clr, w, h);
+    T x0 = P[3], y0 = P[4];
+    vector<T> trgData = trgtDataCalc<T>(sat, P[3], P[4], radi*2);
+    LMTacheFast<T> ellipseLMA(P[3], P[4], radi*2, clr, w, h);
     T rmse = ellipseLMA.minimize(P, trgData, 0.01);
-    T lambda1 = P[0];
-    T lambda2 = P[1];
-    T theta = P[2];
+    // a fit that diverged or left the spot is not a center
+    if (!(rmse == rmse) || (P[3]-x0)*(P[3]-x0)+(P[4]-y0)*(P[4]-y0) > radi*radi)
+        return false;
     centerX = P[3];
     centerY = P[4];
+    P[11] = rmse;
     Pout = P;
-    // Pout[11]=rmse;
     return true;
 }
 
 template<typename T>
-bool centerSimple(const ImageGray<double> &sub_img, bool clr, T &centerX, T &centerY,
+bool centerSimple(const ImageGrayView<double> &sub_img, bool clr, T &centerX, T &centerY,
                   vector<T> &Pout)
 {
-    ImageGray<double> img_avg;
-    average_image(sub_img, img_avg);
     int w = sub_img.xsize();
     int h = sub_img.ysize();
     T cx = w/2, cy = h/2, radi = 0.4*w;
@@ -316,9 +329,11 @@ bool centerSimple(const ImageGray<double> &sub_img, bool clr, T &centerX, T &cen
     return true;
 }
 
+/* View of the square of side 2.5*radi around (cx,cy), of top-left corner (x0,y0) in IMG, the
+   pixels outside of IMG read as background */
 template<typename T>
-void takeSubImg(const ImageGray<double> &IMG, T cx, T cy, T radi, int &x0, int &y0,
-                ImageGray<double> &imgOut)
+ImageGrayView<double> takeSubImg(const ImageGray<double> &IMG, T cx, T cy, T radi, int &x0,
+                                 int &y0)
 {
     int size = 2.5 * radi;
     int x1 = cx - 0.5*size, x2 = cx + 0.5*size;
@@ -327,53 +342,130 @@ void takeSubImg(const ImageGray<double> &IMG, T cx, T cy, T radi, int &x0, int &
     y0 = y1;
     if (y2-y1 != x2-x1)
         y2 = y1+x2-x1;
-    imgOut.resize(x2-x1, y2-y1);
-    for (int i = 0; i < imgOut.xsize(); i++) {
-        for (int j = 0; j < imgOut.ysize(); j++)
-            if (IMG.pixelInside(x1+i, y1+j))
-                imgOut.pixel(i, j) = IMG.pixel(x1+i, y1+j);
-            else
-                imgOut.pixel(i, j) = 255;
+    return ImageGrayView<double>(IMG, x1, y1, x2-x1, y2-y1, 255);
+}
+
+/* Height of the strips of rows thresholded in parallel */
+#define BINARIZATION_STRIP 128
+
+/* Minimum and maximum of the rows [y0,y1) of img, without its 4 pixels wide border */
+static void extremasStrip(const ImageGray<double> *img, int y0, int y1, double *min, double *max)
+{
+    int x0 = 4, x1 = img->xsize()-4;
+    double mn = 255, mx = 0;
+    for (int y = y0; y < y1 && x0 < x1; y++) {
+        const double *p = &img->data(y*img->xsize());
+        int x = x0;
+#ifdef __SSE2__
+        __m128d vmin = _mm_set1_pd(mn), vmax = _mm_set1_pd(mx);
+        __m128d vmin2 = vmin, vmax2 = vmax;
+        for (; x+4 <= x1; x += 4) {
+            __m128d v = _mm_loadu_pd(p+x), v2 = _mm_loadu_pd(p+x+2);
+            vmin = _mm_min_pd(vmin, v);
+            vmax = _mm_max_pd(vmax, v);
+            vmin2 = _mm_min_pd(vmin2, v2);
+            vmax2 = _mm_max_pd(vmax2, v2);
+        }
+        double lane[2];
+        _mm_storeu_pd(lane, _mm_min_pd(vmin, vmin2));
+        mn = std::min(lane[0], lane[1]);
+        _mm_storeu_pd(lane, _mm_max_pd(vmax, vmax2));
+        mx = std::max(lane[0], lane[1]);
+#endif
+        for (; x < x1; x++) {
+            mn = std::min(mn, p[x]);
+            mx = std::max(mx, p[x]);
+        }
     }
+    *min = mn;
+    *max = mx;
 }
 
-template<typename T>
-void binarization(ImageGray<T> &imgbi, const ImageGray<double> &img, T thre)
+/* Set the bits of imgBi for the pixels of the rows [y0,y1) of img whose BYTE value is <= thre */
+static void binarizationStrip(const ImageGray<double> *img, BYTE thre, int y0, int y1,
+                              ImageBit *imgBi)
 {
-    int wi = img.xsize();
-    int he = img.ysize();
-    T color;
-    for (int i = 0; i < wi; i++) {
-        for (int j = 0; j < he; j++) {
-            color = img.pixel(i, j);
-            if (color <= thre) imgbi.pixel(i, j) = 0;
+    int w = img->xsize();
+    // (BYTE)color <= thre  <=>  color < thre+1, for a color in [0,256)
+    double limit = thre+1.0;
+    for (int y = y0; y < y1; y++) {
+        const double *p = &img->data(y*w);
+        uint64_t *bits = imgBi->row(y);
+        for (int xw = 0; xw < w; xw += 64) {
+            const double *pw = p+xw;
+            int n = std::min(64, w-xw);
+            uint64_t word = 0;
+            int x = 0;
+#ifdef __SSE2__
+            __m128d vlimit = _mm_set1_pd(limit);
+            for (; x+8 <= n; x += 8) {
+                int m = _mm_movemask_pd(_mm_cmplt_pd(_mm_loadu_pd(pw+x), vlimit))
+                        | _mm_movemask_pd(_mm_cmplt_pd(_mm_loadu_pd(pw+x+2), vlimit)) << 2
+                        | _mm_movemask_pd(_mm_cmplt_pd(_mm_loadu_pd(pw+x+4), vlimit)) << 4
+                        | _mm_movemask_pd(_mm_cmplt_pd(_mm_loadu_pd(pw+x+6), vlimit)) << 6;
+                word |= (uint64_t)m << x;
+            }
+#endif
+            for (; x < n; x++)
+                word |= (uint64_t)(pw[x] < limit) << x;
+            bits[xw>>6] = word;
         }
     }
 }
 
-template<typename T>
-void img_extremas(const ImageGray<double> &img, T &min, T &max)
+/* Binary image of the pixels of img whose BYTE value is <= thre, by strips of rows */
+void binarization(ImageBit &imgbi, const ImageGray<double> &img, BYTE thre)
+{
+    int he = img.ysize();
+    imgbi.resize(img.xsize(), he);
+    std::vector<concurrent::Future<void>*> ftrs;
+    for (int y = 0; y < he; y += BINARIZATION_STRIP)
+        ftrs.push_back(concurrent::asyncInvoke(DEFAULT_THREAD_POOL, &binarizationStrip,
+                                               (const ImageGray<double> *)&img, thre, y,
+                                               std::min(y+BINARIZATION_STRIP, he), &imgbi));
+    bool allOk;
+    concurrent::getFtr_CheckExcpt(allOk, ftrs);
+    std::for_each(ftrs.begin(), ftrs.end(), [](concurrent::Future<void>* ftr){ delete ftr; });
+    if (!allOk)
+        libMsg::error("binarization: a task failed.");
+}
+
+/* Extremas of img without its 4 pixels wide border, by strips of rows */
+void img_extremas(const ImageGray<double> &img, double &min, double &max)
 {
+    int he = img.ysize();
+    int nStrips = std::max(0, (he-8+BINARIZATION_STRIP-1)/BINARIZATION_STRIP);
+    std::vector<double> mins(nStrips), maxs(nStrips);
+    std::vector<concurrent::Future<void>*> ftrs;
+    for (int s = 0; s < nStrips; s++) {
+        int y = 4+s*BINARIZATION_STRIP;
+        ftrs.push_back(concurrent::asyncInvoke(DEFAULT_THREAD_POOL, &extremasStrip,
+                                               (const ImageGray<double> *)&img, y,
+                                               std::min(y+BINARIZATION_STRIP, he-4),
+                                               &mins[s], &maxs[s]));
+    }
+    bool allOk;
+    concurrent::getFtr_CheckExcpt(allOk, ftrs);
+    std::for_each(ftrs.begin(), ftrs.end(), [](concurrent::Future<void>* ftr){ delete ftr; });
+    if (!allOk)
+        libMsg::error("img_extremas: a task failed.");
     min = 255;
     max = 0;
-    for (int i = 4; i < img.xsize()-4; i++) {
-        for (int j = 4; j < img.ysize()-4; j++) {
-            T clr = img.pixel(i, j);
-            if (clr > max) max = clr;
-            if (clr < min) min = clr;
-        }
+    for (int s = 0; s < nStrips; s++) {
+        min = std::min(min, mins[s]);
+        max = std::max(max, maxs[s]);
     }
 }
 
 bool circleRedefineSegment(const ImageGray<double> *img, ImageRGB<BYTE> *feedback,
                            vector<double> *x, vector<double> *y, const vector<double> *r,
                            double scale, bool clr, std::vector<vector<double> > *Pout, int from,
-                           int count, std::atomic_int *progress)
+                           int count, std::atomic_int *progress, std::atomic_int *fallbacks)
 {
+    ImageGray<double> sat; // summed-area table of the sub image, reused for the circles
     for (int i = from; i < from+count; i++) {
         int x0, y0;
-        ImageGray<double> sub_img;
-        takeSubImg(*img, (*x)[i], (*y)[i], (*r)[i], x0, y0, sub_img);
+        ImageGrayView<double> sub_img = takeSubImg(*img, (*x)[i], (*y)[i], (*r)[i], x0, y0);
         vector<double> P;
         double cx = 0, cy = 0;
         int wi = sub_img.xsize();
@@ -392,8 +484,12 @@ bool circleRedefineSegment(const ImageGray<double> *img, ImageRGB<BYTE> *feedbac
                 feedback->pixel_R(x0+wi-1, k+y0) = 0;
         }
         // feed back]
-        //if (!centerLMA<double>(sub_img, clr, cx, cy, P)) return false;
-        if (!centerSimple<double>(sub_img, clr, cx, cy, P)) return false;
+        // the ellipse model fit, or the weighted barycenter when it fails; run on the pool,
+        // so the fallbacks are only counted and reported once all the tasks are done
+        if (!centerLMA<double>(sub_img, sat, clr, cx, cy, P)) {
+            if (!centerSimple<double>(sub_img, clr, cx, cy, P)) return false;
+            fallbacks->fetch_add(1, std::memory_order_relaxed);
+        }
         libMsg::abortIfAsked();
 
         (*x)[i] = scale*(x0 + cx);
@@ -442,8 +538,7 @@ bool keypnts_circle_no_refine(const ImageGray<double> &img, ImageRGB<BYTE> &imgF
     double minColor = 255;
     img_extremas(img, minColor, maxColor);
     BYTE thre = (BYTE)(0.4*(maxColor-minColor));
-    ImageGray<BYTE> imgBi;
-    imgBi.resize(wi, he, 255);
+    ImageBit imgBi;
     imgFeedback.resize(wi, he, 255, 255, 255);
     binarization(imgBi, img, thre);
     // write_pgm_image_double(imgbiB, "rawdata/b.pgm");
@@ -464,60 +559,38 @@ bool keypnts_circle_no_refine(const ImageGray<double> &img, ImageRGB<BYTE> &imgF
     return true;
 }
 
-bool keypnts_circle(const ImageGray<double> &img, ImageRGB<BYTE> &imgFeedback, vector<double> &x,
-                    vector<double> &y, vector<double> &r, double scale,
-                    std::vector<vector<double> > &P,
-                    concurrent::AbstractThreadPool& pool = DEFAULT_THREAD_POOL)
+/* Refine the centers (x,y) of the circles of radius r found by keypnts_circle_no_refine() */
+bool circle_refine(const ImageGray<double> &img, ImageRGB<BYTE> &imgFeedback, vector<double> &x,
+                   vector<double> &y, const vector<double> &r, double scale,
+                   std::vector<vector<double> > &P,
+                   concurrent::AbstractThreadPool& pool = DEFAULT_THREAD_POOL)
 {
     auto startTime = std::chrono::high_resolution_clock::now();
-    int wi = img.xsize(), he = img.ysize();
-
-    double maxColor = 0;
-    double minColor = 255;
-    img_extremas(img, minColor, maxColor);
-    BYTE thre = (BYTE)(0.4*(maxColor-minColor));
-    ImageGray<BYTE> imgBi;
-    imgBi.resize(wi, he, 255);
-    imgFeedback.resize(wi, he, 255, 255, 255);
-    binarization(imgBi, img, thre);
-    // write_pgm_image_double(imgbiB, "rawdata/b.pgm");
-
-    libMsg::cout<<"finding connected components... "<<libMsg::endl;
-    std::vector<CCStats> ccstats;
-    if (!CC(ccstats, imgBi, imgFeedback)) return false;
-
-    int ntaches = ccstats.size();
-    x = x.ones(ntaches);
-    y = y.ones(ntaches);
-    r = r.ones(ntaches);
-    for (int i = 0; i < ntaches; i++) {
-        x[i] = ccstats[i].centerX;
-        y[i] = ccstats[i].centerY;
-        r[i] = (ccstats[i].radius1+ccstats[i].radius2)/2;
-    }
+    int ntaches = x.size();
     bool clr = 0;
     for (int i = 0; i < ntaches; ++i) P.push_back(vector<double>());
 
     // Lauche Multitask{
     std::vector<concurrent::Future<bool>*> ftrs;
     int from = 0;
-    std::atomic_int progress;
+    std::atomic_int progress, fallbacks;
     progress.store(0);
+    fallbacks.store(0);
 
     const static int TASK_SIZE = 10;
     while (from+TASK_SIZE < ntaches) {
         ftrs.push_back(concurrent::asyncInvoke(
                         pool, &circleRedefineSegment,
                         (const ImageGray<double> *)(&img), &imgFeedback, &x, &y,
-                        (const vector<double> *)(&r), scale, clr, &P,
-                                              from, TASK_SIZE, &progress));
+                        &r, scale, clr, &P,
+                                              from, TASK_SIZE, &progress, &fallbacks));
         from += TASK_SIZE;
     }
     ftrs.push_back(concurrent::asyncInvoke(
                         pool, &circleRedefineSegment,
                         (const ImageGray<double> *)(&img), &imgFeedback, &x, &y,
-                        (const vector<double> *)(&r), scale, clr, &P,
-                        from, ntaches-from, &progress));
+                        &r, scale, clr, &P,
+                        from, ntaches-from, &progress, &fallbacks));
     // }Lauche MultiTask
 
     // Report progress and wait for all task to finish
@@ -532,6 +605,9 @@ bool keypnts_circle(const ImageGray<double> &img, ImageRGB<BYTE> &imgFeedback, v
         libMsg::cout<<" Done, "<<std::chrono::duration<double, std::milli>(
             std::chrono::high_resolution_clock::now() -startTime).count() *1e-3
                     <<" Seconds spent." << libMsg::endl;
+        if (fallbacks.load() > 0)
+            libMsg::cout<<fallbacks.load()<<" centers taken as the weighted barycenter, the ellipse"
+                          " model did not fit"<<libMsg::endl;
         return true;
     } else {
         return false;
@@ -542,7 +618,16 @@ bool detectEllipseCenters(const ImageGray<double> &img, ImageRGB<BYTE> &imgFeedb
                           vector<double> &x, vector<double> &y, vector<double> &r,
                           std::vector<vector<double> > &P, double scale)
 {
-    if (!keypnts_circle(img, imgFeedback, x, y, r, scale, P)) return false;
+    if (!keypnts_circle_no_refine(img, imgFeedback, x, y, r)) return false;
+    if (!circle_refine(img, imgFeedback, x, y, r, scale, P)) return false;
+    return true;
+}
+
+bool refineEllipseCenters(const ImageGray<double> &img, ImageRGB<BYTE> &imgFeedback,
+                          vector<double> &x, vector<double> &y, const vector<double> &r,
+                          std::vector<vector<double> > &P, double scale)
+{
+    if (!circle_refine(img, imgFeedback, x, y, r, scale, P)) return false;
     return true;
 }
 
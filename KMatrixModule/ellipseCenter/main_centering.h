@@ -6,6 +6,12 @@ bool detectEllipseCenters(const ImageGray<double> &img, ImageRGB<BYTE> &imgFeedb
                           libNumerics::vector<double> &x, libNumerics::vector<double> &y,
                           libNumerics::vector<double> &r,
                           std::vector<libNumerics::vector<double> > &P, double scale);
+// refines the centers found by detectEllipseCenters_noRefine(), gives the same result as
+// detectEllipseCenters() without detecting the circles again
+bool refineEllipseCenters(const ImageGray<double> &img, ImageRGB<BYTE> &imgFeedback,
+                          libNumerics::vector<double> &x, libNumerics::vector<double> &y,
+                          const libNumerics::vector<double> &r,
+                          std::vector<libNumerics::vector<double> > &P, double scale);
 bool detectEllipseCenters_noRefine(const ImageGray<double> &img, ImageRGB<BYTE> &imgFeedback,
                                    libNumerics::vector<double> &x, libNumerics::vector<double> &y,
                                    libNumerics::vector<double> &r);
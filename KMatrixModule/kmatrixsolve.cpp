@@ -8,8 +8,16 @@
 #include "Hmatrix.h"
 #include "ellipse_operations.h"
 #include "qimageconvert.h"
+// libConcurrent
+#include "abstractthreadpool.h"
+#include "stlCallable.h"
+#include "qthreadpoolbridge.h"
 #include <QImage>
 #include <QPainter>
+#include <QThreadPool>
+#include <atomic>
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 #include <sstream>
 #include <utility>
@@ -20,60 +28,59 @@ static double cross2D(vector<double> v1, vector<double> v2)
     return v1(0)*v2(1)-v2(0)*v1(1);
 }
 
+static double turn2D(const matrix<double> &circles, int i0, int i1, int i2)
+{
+    return (circles(0, i1)-circles(0, i0))*(circles(1, i2)-circles(1, i1))
+           -(circles(0, i2)-circles(0, i1))*(circles(1, i1)-circles(1, i0));
+}
+
 static bool convexHull(matrix<double> &circles, std::vector<vector<double> > &hullPoints,
                        std::vector<int> &hullIndex)
 {
     // convex hull
-    // Gift wrapping algorithm with collinear case
+    // Andrew's monotone chain. The hull starts from the most left point and turns the same way
+    // as gift wrapping did, so that findCorner() numbers the corners the same
     hullPoints.clear();
     hullIndex.clear();
     int nCircle = circles.ncol();
     if (nCircle <= 0) return false;
-    double minX = 1e15;
-    int minIdx = -1;
+    int minIdx = 0;
     // find the most left point
-    for (int i = 0; i < nCircle; ++i) {
-        if (circles(0, i) < minX) {
-            minX = circles(0, i);
+    for (int i = 1; i < nCircle; ++i)
+        if (circles(0, i) < circles(0, minIdx))
             minIdx = i;
-        }
+    if (nCircle == 1) {
+        hullPoints.push_back(circles.col(minIdx));
+        hullIndex.push_back(minIdx);
+        return true;
     }
-    vector<double> p1, p2;
-    int idxP1 = minIdx;
-    p1 = circles.col(idxP1);
-    hullPoints.push_back(p1);
-    hullIndex.push_back(idxP1);
-    double maxDot = -1e15;
-    int idxP2;
-    for (int j = 0; j < nCircle; ++j) {
-        vector<double> p = circles.col(j);
-        double dotValue = dot((p-p1)/std::sqrt((p-p1).qnorm()), vector<double>(0.0, -1.0));
-        if (dotValue > maxDot) {
-            maxDot = dotValue;
-            idxP2 = j;
-        }
+    std::vector<int> order(nCircle);
+    for (int i = 0; i < nCircle; ++i)
+        order[i] = i;
+    std::sort(order.begin(), order.end(), [&circles](int i, int j) {
+        if (circles(0, i) != circles(0, j)) return circles(0, i) < circles(0, j);
+        if (circles(1, i) != circles(1, j)) return circles(1, i) < circles(1, j);
+        return i < j;
+    });
+    // side of smaller y first, then back along the other one
+    std::vector<int> hull(2*nCircle);
+    int k = 0;
+    for (int i = 0; i < nCircle; ++i) {
+        while (k >= 2 && turn2D(circles, hull[k-2], hull[k-1], order[i]) <= 0) k--;
+        hull[k++] = order[i];
+    }
+    for (int i = nCircle-2, lower = k+1; i >= 0; --i) {
+        while (k >= lower && turn2D(circles, hull[k-2], hull[k-1], order[i]) <= 0) k--;
+        hull[k++] = order[i];
+    }
+    k--; // the first point closes the hull
+    int start = std::find(hull.begin(), hull.begin()+k, minIdx)-hull.begin();
+    if (start == k) start = 0; // most left point not a vertex, only when they are all aligned
+    for (int i = 0; i < k; ++i) {
+        int idx = hull[(start+i)%k];
+        hullPoints.push_back(circles.col(idx));
+        hullIndex.push_back(idx);
     }
-    p2 = circles.col(idxP2);
-
-    do {
-        hullPoints.push_back(p2);
-        hullIndex.push_back(idxP2);
-        vector<double> p1p2 = (p2-p1)/std::sqrt((p2-p1).qnorm());
-        maxDot = -1e15;
-        int idxNext = -1;
-        for (int j = 0; j < nCircle; ++j) {
-            vector<double> Sj = circles.col(j);
-            double dotValue = dot((Sj-p2)/std::sqrt((Sj-p2).qnorm()), p1p2);
-            if (dotValue > maxDot) {
-                maxDot = dotValue;
-                idxNext = j;
-            }
-        }
-        p1 = p2;
-        idxP1 = idxP2;
-        idxP2 = idxNext;
-        p2 = circles.col(idxNext);
-    } while (idxP2 != minIdx);
     return true;
 }
 
@@ -119,6 +126,85 @@ static bool findCorner(matrix<double> &circles, int &idx1, int &idx2, int &idx3,
     return true;
 }
 
+/* Uniform grid of cells over the circle centers, with about one center per cell, to pick the
+   center nearest to a point among the ones not picked yet without going through all of them */
+class CircleGrid
+{
+public:
+    CircleGrid(const matrix<double> &circles);
+    // the lowest index among the nearest centers not picked yet, as a linear search gives
+    int pickNearest(double x, double y);
+
+private:
+    const matrix<double> &circles;
+    double x0, y0, cell;
+    int nx, ny;
+    std::vector<int> cellStart, cellItems;
+    std::vector<bool> picked;
+
+    int cellX(double x) const { return std::min(nx-1, std::max(0, (int)std::floor((x-x0)/cell))); }
+    int cellY(double y) const { return std::min(ny-1, std::max(0, (int)std::floor((y-y0)/cell))); }
+};
+
+CircleGrid::CircleGrid(const matrix<double> &circles) : circles(circles),
+    picked(circles.ncol(), false)
+{
+    int nCircle = circles.ncol();
+    double x1 = x0 = circles(0, 0), y1 = y0 = circles(1, 0);
+    for (int i = 1; i < nCircle; ++i) {
+        x0 = std::min(x0, circles(0, i));
+        x1 = std::max(x1, circles(0, i));
+        y0 = std::min(y0, circles(1, i));
+        y1 = std::max(y1, circles(1, i));
+    }
+    // also about one center per cell when they are aligned
+    cell = std::max(std::sqrt((x1-x0)*(y1-y0)/nCircle), (x1-x0+y1-y0)/nCircle);
+    if (!(cell > 0)) cell = 1;
+    nx = (int)((x1-x0)/cell)+1;
+    ny = (int)((y1-y0)/cell)+1;
+    // centers sorted by cell
+    cellStart.assign(nx*ny+1, 0);
+    for (int i = 0; i < nCircle; ++i)
+        cellStart[cellY(circles(1, i))*nx+cellX(circles(0, i))+1]++;
+    for (int c = 0; c < nx*ny; ++c)
+        cellStart[c+1] += cellStart[c];
+    cellItems.resize(nCircle);
+    std::vector<int> fill(cellStart.begin(), cellStart.end()-1);
+    for (int i = 0; i < nCircle; ++i)
+        cellItems[fill[cellY(circles(1, i))*nx+cellX(circles(0, i))]++] = i;
+}
+
+int CircleGrid::pickNearest(double x, double y)
+{
+    int cx = cellX(x), cy = cellY(y);
+    int rMax = std::max(std::max(cx, nx-1-cx), std::max(cy, ny-1-cy));
+    double minDistance = 1e15;
+    int minIdx = -1;
+    // rings of cells around (cx,cy), the centers from ring r on are at least (r-1)*cell away
+    for (int r = 0; r <= rMax; ++r) {
+        if (r >= 2 && minIdx >= 0 && minDistance < (r-1.01)*(r-1.01)*cell*cell) break;
+        for (int j = std::max(0, cy-r); j <= std::min(ny-1, cy+r); ++j) {
+            int step = (j == cy-r || j == cy+r) ? 1 : 2*r;
+            for (int i = cx-r; i <= cx+r; i += step) {
+                if (i < 0 || i >= nx) continue;
+                for (int c = cellStart[j*nx+i]; c < cellStart[j*nx+i+1]; ++c) {
+                    int idx = cellItems[c];
+                    if (picked[idx]) continue;
+                    double dx = circles(0, idx)-x, dy = circles(1, idx)-y;
+                    double squareDist = dx*dx+dy*dy;
+                    if (squareDist < minDistance || (squareDist == minDistance && idx < minIdx)) {
+                        minIdx = idx;
+                        minDistance = squareDist;
+                    }
+                }
+            }
+        }
+    }
+    if (minIdx >= 0)
+        picked[minIdx] = true;
+    return minIdx;
+}
+
 static bool sortCircles(matrix<double> &circles, int &nRow, int &nCol /*, QImage &qimage*/)
 {
     int idx1, idx2, idx3, idx4;
@@ -213,22 +299,9 @@ static bool sortCircles(matrix<double> &circles, int &nRow, int &nCol /*, QImage
 // }
 // qimage.save("test.jpg",0,100);
     matrix<double> sortedCircle(2, nCircle);
-    k = 0;
-    std::vector<bool> picked(nCircle, false);
+    CircleGrid grid(circles);
     for (int i = 0; i < nCircle; ++i) {
-        vector<double> p = UV.col(i);
-        double minDistance = 1e15;
-        int minIdx = -1;
-        for (int j = 0; j < nCircle; ++j) {
-            if (picked[j]) continue;
-            vector<double> q = circles.col(j);
-            double squareDist = (q-p).qnorm();
-            if (squareDist < minDistance) {
-                minIdx = j;
-                minDistance = squareDist;
-            }
-        }
-        picked[minIdx] = true;
+        int minIdx = grid.pickNearest(UV(0, i), UV(1, i));
         sortedCircle(0, i) = circles(0, minIdx);
         sortedCircle(1, i) = circles(1, minIdx);
     }
@@ -268,8 +341,113 @@ static void rotateGridRight(matrix<double> &grid, int nRow, int nCol)
     }
 }
 
+/* What detectImageCircles() found in one image */
+struct ImageCircles
+{
+    std::string log;         // messages printed during the detection
+    QImage feedback;
+    QPicture overlay;        // drawn over feedback when it is displayed
+    bool refined;            // false if the coarse centers could not be sorted
+    int nCircle;
+    matrix<double> centers;  // refined centers, sorted if sorted is true
+    bool sorted;
+    int nRow, nCol;
+    ImageCircles() : refined(false), nCircle(0), sorted(false), nRow(0), nCol(0) {}
+};
+
+/* Detect, check and refine the circles of one image, one task of KMatrixSolver() */
+static bool detectImageCircles(const QImage *qimage, ImageCircles *res, std::atomic_int *progress)
+{
+    libMsg::abortIfAsked();
+    libMsg::CaptureScope capture(res->log);
+    vector<double> x, y, r;
+    ImageRGB<BYTE> imgFeedback;
+    std::vector<vector<double> > P;
+    ImageGray<double> imageDouble;
+    QImage2ImageDouble(*qimage, imageDouble);
+    if (!detectEllipseCenters_noRefine(imageDouble, imgFeedback, x, y, r)) return false;
+    res->nCircle = x.size();
+
+    // check the coarse centers before refining them
+    {
+        matrix<double> centers(2, x.size());
+        for (int j = 0; j < x.size(); ++j) {
+            centers(0, j) = x(j);
+            centers(1, j) = y(j);
+        }
+        int nRow_i, nCol_i;
+        if (!sortCircles(centers, nRow_i, nCol_i)) {
+            // feedback img of the coarse detection
+            ImageByteRGB2QColorImage(imgFeedback, res->feedback);
+            QPainter painter(&res->overlay);
+            painter.setRenderHint(QPainter::Antialiasing);
+            for (int j = 0; j < x.size(); j++) {
+                double xx = x(j);
+                double yy = y(j);
+                painter.setPen(Qt::red);
+                painter.resetTransform();
+                painter.translate(xx, yy);
+                painter.drawText(QRectF(5, 5, 30, 30), QString::number(j));
+            }
+            progress->fetch_add(1, std::memory_order_release);
+            return true;
+        }
+    }
+
+    // refine the circle centers
+    if (!refineEllipseCenters(imageDouble, imgFeedback, x, y, r, P, 1.0)) return false;
+    //P[0] = 1.0/rayon;                            lambda1
+    //P[1] = (std::sqrt(lambda1/lambda2))/rayon;   lambda2
+    //P[2] = std::atan2(sx2/ss-lambda1, -sxy/ss);  alpha
+    //P[3] = x;            tu
+    //P[4] = y;            tv
+    //P[5] = 0.25;         rayon cercle 1
+    //P[6] = -2.0;         pente
+    //P[7] = 0.25;         rayon cercle 2
+    //P[8] = val_haut;     val_haut
+    //P[9] = val_bas;      val_bas
+    //P[10] = 1.0;         position step
+    //P[11] = RMSE         error
+    res->refined = true;
+    res->centers = matrix<double>::zeros(2, x.size());
+    for (int j = 0; j < x.size(); ++j) {
+        res->centers(0, j) = x(j);
+        res->centers(1, j) = y(j);
+    }
+    // draw feedback
+    ImageByteRGB2QColorImage(imgFeedback, res->feedback);
+    QPainter painter(&res->overlay);
+    painter.setRenderHint(QPainter::Antialiasing);
+    for (int j = 0; j < x.size(); j++) {
+        double xx = x(j);
+        double yy = y(j);
+        double r1 = 1/P[j](0);
+        double r2 = 1/P[j](1);
+        double alpha = P[j](2);
+        double rmse = P[j](11);
+        painter.setPen(Qt::blue);
+        painter.resetTransform();
+        painter.translate(xx, yy);
+        painter.drawText(QRectF(5, 5, 30, 30), QString::number(j));
+        if(rmse>4.0)
+            painter.setPen(Qt::red);
+        painter.drawText(QRectF(5, 25, 50, 30),QString::number(rmse));
+
+        painter.rotate(-alpha/3.14159265358979323*180);
+        painter.setPen(Qt::red);
+        painter.drawLine(QPointF(-r1, 0), QPointF(r1, 0));
+        painter.setPen(Qt::green);
+        painter.drawLine(QPointF(0, -r2), QPointF(0, r2));
+    }
+    painter.end();
+    // end draw feedback
+    res->sorted = sortCircles(res->centers, res->nRow, res->nCol);
+    progress->fetch_add(1, std::memory_order_release);
+    return true;
+}
+
 bool KMatrixSolve::KMatrixSolver(std::vector<QImage> &imageList, std::vector<QImage> &feedbackList,
-                                 double &alpha, double &beta, double &u0, double &v0, double &gamma,
+                                 std::vector<QPicture> &overlayList, double &alpha, double &beta, double &u0, double &v0, double &gamma,
                                  double seperation, double radius)
 {
     int nImage = imageList.size();
@@ -277,9 +455,8 @@ bool KMatrixSolve::KMatrixSolver(std::vector<QImage> &imageList, std::vector<QIm
     int nCircleOf1stImage;
     int nRow, nCol;
     feedbackList.clear();
-    // go through all image to check validity
-    libMsg::cout<<"Step 1: check all images to know whether they all have the same circle points"
-                <<libMsg::endl;
+    overlayList.clear();
+    libMsg::cout<<"Step 1: detect and refine the circle centers of all images"<<libMsg::endl;
     libMsg::cout
         <<
         "For the feedback images:\n"
@@ -289,150 +466,79 @@ bool KMatrixSolve::KMatrixSolver(std::vector<QImage> &imageList, std::vector<QIm
         "\tBlue region : filtered\n"
         "Number beside circle:\n\t\tindex\n\t\tindex after sort\n\t\terror RMSE"
         <<libMsg::endl<<libMsg::endl;
-    for (int i = 0; i < nImage; ++i) {
-        libMsg::cout<<"Image "<<i+1<<'/'<<nImage<<libMsg::endl;
-        vector<double> x, y, r;
-        ImageRGB<BYTE> imgFeedback;
-        {
-            ImageGray<double> imageDouble;
-            QImage2ImageDouble(imageList[i], imageDouble);
-            if (!detectEllipseCenters_noRefine(imageDouble, imgFeedback, x, y, r)) return false;
-        }
-        matrix<double> centers(2, x.size());
-        for (int j = 0; j < x.size(); ++j) {
-            centers(0, j) = x(j);
-            centers(1, j) = y(j);
-        }
-        // feedback img
-        QImage image;
-        ImageByteRGB2QColorImage(imgFeedback, image);
-        QPainter painter(&image);
-        painter.setRenderHint(QPainter::Antialiasing);
-        for (int j = 0; j < x.size(); j++) {
-            double xx = x(j);
-            double yy = y(j);
-            painter.setPen(Qt::red);
-            painter.resetTransform();
-            painter.translate(xx, yy);
-            painter.drawText(QRectF(5, 5, 30, 30), QString::number(j));
-        }
-        feedbackList.push_back(image);
-        if (i == 0) {
-            nCircleOf1stImage = x.size();
-        } else if (x.size() != nCircleOf1stImage) {
-            libMsg::cout<<"The number of circles detected in Image_"<<i<<" is "<<x.size()
-                        <<
-                " , which is different from last image! Please check. Algorithm terminates"
-                        <<libMsg::endl;
-            return false;
-        }
 
-        int nRow_i, nCol_i;
-        if (!sortCircles(centers, nRow_i, nCol_i)) return false;
-        if (i == 0) {
-            nRow = nRow_i;
-            nCol = nCol_i;
-        } else {
-            if (!(nRow == nRow_i && nCol == nCol_i)) {
-                if (!(nCol == nRow_i && nRow == nCol_i)) {
-                    libMsg::cout<<"Image_"<<i<<" doesn't have the same nRow and nCol as Image_0 !"
-                                <<libMsg::endl;
-                    return false;
-                }
-            }
-        }
-    }
-    // refine the circle centers
-    libMsg::cout<<"\n\nStep 2: refine circle centers"<<libMsg::endl<<libMsg::endl;
-    feedbackList.clear();
-    for (int i = 0; i < nImage; ++i) {
-        libMsg::cout<<"\nImage "<<i+1<<'/'<<nImage<<libMsg::endl;
-        vector<double> x, y, r;
-        ImageRGB<BYTE> imgFeedback;
-        std::vector<vector<double> > P;
-        {
-            ImageGray<double> imageDouble;
-            QImage2ImageDouble(imageList[i], imageDouble);
-            if (!detectEllipseCenters(imageDouble, imgFeedback, x, y, r, P, 1.0)) return false;
-        }
-        //P[0] = 1.0/rayon;                            lambda1
-        //P[1] = (std::sqrt(lambda1/lambda2))/rayon;   lambda2
-        //P[2] = std::atan2(sx2/ss-lambda1, -sxy/ss);  alpha
-        //P[3] = x;            tu
-        //P[4] = y;            tv
-        //P[5] = 0.25;         rayon cercle 1
-        //P[6] = -2.0;         pente
-        //P[7] = 0.25;         rayon cercle 2
-        //P[8] = val_haut;     val_haut
-        //P[9] = val_bas;      val_bas
-        //P[10] = 1.0;         position step
-        //P[11] = RMSE         error
-        Ellipse_centers.push_back(matrix<double>::zeros(2, x.size()));
-        matrix<double> &centers = Ellipse_centers.back();
-        for (int j = 0; j < x.size(); ++j) {
-            centers(0, j) = x(j);
-            centers(1, j) = y(j);
-        }
-        // draw feedback
-        QImage image;
-        ImageByteRGB2QColorImage(imgFeedback, image);
-        QPainter painter(&image);
-        painter.setRenderHint(QPainter::Antialiasing);
-        for (int j = 0; j < x.size(); j++) {
-            double xx = x(j);
-            double yy = y(j);
-            double r1 = 1/P[j](0);
-            double r2 = 1/P[j](1);
-            double alpha = P[j](2);
-            double rmse = P[j](11);
-            painter.setPen(Qt::blue);
-            painter.resetTransform();
-            painter.translate(xx, yy);
-            painter.drawText(QRectF(5, 5, 30, 30), QString::number(j));
-            if(rmse>4.0)
-                painter.setPen(Qt::red);
-            painter.drawText(QRectF(5, 25, 50, 30),QString::number(rmse));
+    // one task per image, on their own pool since the detection itself waits for tasks
+    // run on the default one. Each task holds a full size double image until its centers
+    // are refined, so only two images are in flight at once.
+    std::vector<ImageCircles> circles(nImage);
+    {
+        QThreadPool imagePool;
+        imagePool.setMaxThreadCount(2);
+        QThreadpoolBridge imageThreadPool(&imagePool);
+        std::atomic_int progress;
+        progress.store(0);
 
-            painter.rotate(-alpha/3.14159265358979323*180);
-            painter.setPen(Qt::red);
-            painter.drawLine(QPointF(-r1, 0), QPointF(r1, 0));
-            painter.setPen(Qt::green);
-            painter.drawLine(QPointF(0, -r2), QPointF(0, r2));
-        }
+        // Lauche MultiTask{
+        std::vector<concurrent::Future<bool>*> ftrs;
+        for (int i = 0; i < nImage; ++i)
+            ftrs.push_back(concurrent::asyncInvoke(
+                               imageThreadPool, &detectImageCircles,
+                               (const QImage *)(&imageList[i]), &circles[i], &progress));
+        // }Lauche MultiTask
 
-        feedbackList.push_back(image);
-        // end draw feedback
+        // Report progress and wait for all task to finish
+        concurrent::ReportProgrsAndWaitFtr(progress, nImage, ftrs);
+
+        // messages of the tasks in image order, also when one of them failed
+        for (int i = 0; i < nImage; ++i)
+            libMsg::cout<<"\nImage "<<i+1<<'/'<<nImage<<libMsg::endl<<circles[i].log<<libMsg::flush;
+
+        // get futures and handle exceptions in multi-task
+        bool allOk;
+        concurrent::getFtr_CheckExcpt(allOk, ftrs);
+        std::for_each(ftrs.begin(), ftrs.end(), [](concurrent::Future<bool>* ftr){ delete ftr; });
+        if (!allOk) return false;
+    }
+
+    // check the images in order
+    for (int i = 0; i < nImage; ++i) {
+        ImageCircles &res = circles[i];
+        feedbackList.push_back(res.feedback);
+        overlayList.push_back(res.overlay);
+        if (!res.refined) return false;
         if (i == 0) {
-            nCircleOf1stImage = x.size();
-        } else if (x.size() != nCircleOf1stImage) {
-            libMsg::cout<<"The number of circles detected in Image_"<<i<<" is "<<x.size()
+            nCircleOf1stImage = res.nCircle;
+        } else if (res.nCircle != nCircleOf1stImage) {
+            libMsg::cout<<"The number of circles detected in Image_"<<i<<" is "<<res.nCircle
                         <<
                 " , which is different from last image! Please check. Algorithm terminates"
                         <<libMsg::endl;
             return false;
         }
 
-        int nRow_i, nCol_i;
-        if (!sortCircles(centers, nRow_i, nCol_i)) return false;
+        if (!res.sorted) return false;
         if (i == 0) {
-            nRow = nRow_i;
-            nCol = nCol_i;
+            nRow = res.nRow;
+            nCol = res.nCol;
         } else {
-            if (!(nRow == nRow_i && nCol == nCol_i)) {
-                if (!(nCol == nRow_i && nRow == nCol_i)) {
+            if (!(nRow == res.nRow && nCol == res.nCol)) {
+                if (!(nCol == res.nRow && nRow == res.nCol)) {
                     libMsg::cout<<"Image_"<<i<<" doesn't have the same nRow and nCol as Image_0 !"
                                 <<libMsg::endl;
                     return false;
                 } else {
-                    rotateGridLeft(centers, nRow_i, nCol_i);
+                    rotateGridLeft(res.centers, res.nRow, res.nCol);
                 }
             }
         }
+        Ellipse_centers.push_back(res.centers);
     }
-    // draw feedback for sorted index
+    // draw feedback for sorted index, on top of the detection overlay
     for (int i = 0; i < nImage; ++i) {
-        QPainter painter(&feedbackList[i]);
+        QPicture sorted;
+        QPainter painter(&sorted);
         painter.setRenderHint(QPainter::Antialiasing);
+        painter.drawPicture(0, 0, overlayList[i]);
         for (int j = 0; j < Ellipse_centers[i].ncol(); j++) {
             double xx = Ellipse_centers[i](0, j);
             double yy = Ellipse_centers[i](1, j);
@@ -441,6 +547,8 @@ bool KMatrixSolve::KMatrixSolver(std::vector<QImage> &imageList, std::vector<QIm
             painter.translate(xx, yy+10);
             painter.drawText(QRectF(5, 5, 30, 30), QString::number(j));
         }
+        painter.end();
+        overlayList[i] = sorted;
     }
     libMsg::cout<<"nRow="<<nRow<<" nCol="<<nCol<<libMsg::endl;
     std::vector<matrix<double> > S(nCircleOf1stImage);
@@ -4,9 +4,12 @@
 
 #include <vector>
 #include <QImage>
+#include <QPicture>
 namespace KMatrixSolve {
-bool KMatrixSolver(std::vector<QImage> &imageList, std::vector<QImage> &feedbackList, double &alpha,
-                   double &beta, double &u0, double &v0, double &gamma, double seperation,
-                   double radius);
+/* feedbackList: the circle detection of each image, overlayList: the circles found, to be drawn
+   over the feedback images only when they are shown */
+bool KMatrixSolver(std::vector<QImage> &imageList, std::vector<QImage> &feedbackList,
+                   std::vector<QPicture> &overlayList, double &alpha, double &beta, double &u0,
+                   double &v0, double &gamma, double seperation, double radius);
 }
 #endif // KMATRIXSOLVE_H
@@ -0,0 +1,124 @@
+#include "checkpoint.h"
+
+#include <fstream>
+#include <cstdio>
+
+using namespace DistortionModule;
+
+static const uint32_t CHECKPOINT_MAGIC = 0x31434b43; // "CKC1"
+
+template<typename V>
+static void writeValue(std::ofstream &out, const V &value)
+{
+    out.write(reinterpret_cast<const char *>(&value), sizeof(V));
+}
+
+template<typename V>
+static void readValue(std::ifstream &in, V &value)
+{
+    in.read(reinterpret_cast<char *>(&value), sizeof(V));
+}
+
+/* The counts read from the file are bounded by what is left of it, and the file is rejected
+ * unless its lines match its groups and its polynomial matches its order */
+bool EstimeCheckpoint::load(const std::string &path, uint64_t expectedKey, int maxOrder)
+{
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    uint64_t remaining = in ? (uint64_t)in.tellg() : 0;
+    in.seekg(0);
+    uint32_t magic = 0, nGroups = 0, nLines = 0, nParams = 0;
+    uint64_t fileKey = 0;
+    int32_t fileOrder = 0;
+    readValue(in, magic);
+    readValue(in, fileKey);
+    readValue(in, fileOrder);
+    readValue(in, nGroups);
+    const uint64_t header = sizeof(magic)+sizeof(fileKey)+sizeof(fileOrder)+sizeof(nGroups);
+    if (!in || magic != CHECKPOINT_MAGIC || fileKey != expectedKey || remaining < header
+        || fileOrder < 0 || fileOrder > maxOrder)
+        return false;
+    remaining -= header;
+
+    if (nGroups > remaining/sizeof(int32_t))
+        return false;
+    remaining -= nGroups*sizeof(int32_t);
+    std::vector<int> groups(nGroups);
+    uint64_t groupLines = 0;
+    for (uint32_t i = 0; i < groups.size(); ++i) {
+        int32_t n = 0;
+        readValue(in, n);
+        if (n < 0)
+            return false;
+        groups[i] = n;
+        groupLines += n;
+    }
+    readValue(in, nLines);
+    if (!in || remaining < sizeof(nLines))
+        return false;
+    remaining -= sizeof(nLines);
+    if (groupLines != nLines || nLines > remaining/sizeof(uint32_t))
+        return false;
+    LineSet fileLines(nLines);
+    for (uint32_t i = 0; i < fileLines.size(); ++i) {
+        uint32_t nPoints = 0;
+        if (remaining < sizeof(nPoints))
+            return false;
+        readValue(in, nPoints);
+        remaining -= sizeof(nPoints);
+        if (!in || nPoints > remaining/(2*sizeof(double)))
+            return false;
+        remaining -= 2*sizeof(double)*(uint64_t)nPoints;
+        std::vector<double> xy(2*(size_t)nPoints);
+        in.read(reinterpret_cast<char *>(xy.data()), xy.size()*sizeof(double));
+        fileLines[i].resize(nPoints);
+        for (size_t j = 0; j < fileLines[i].size(); ++j)
+            fileLines[i][j] = std::make_pair(xy[2*j], xy[2*j+1]);
+    }
+    readValue(in, nParams);
+    /* both coordinates of the polynomial, none right after the detection */
+    const uint32_t expectedParams = fileOrder == 0 ? 0 : (fileOrder+1)*(fileOrder+2);
+    if (!in || nParams != expectedParams || remaining < sizeof(nParams)
+        || nParams > (remaining-sizeof(nParams))/sizeof(double))
+        return false;
+    std::vector<double> fileParams(nParams);
+    in.read(reinterpret_cast<char *>(fileParams.data()), fileParams.size()*sizeof(double));
+    if (!in)
+        return false;
+
+    key = fileKey;
+    order = fileOrder;
+    nlines4Group.swap(groups);
+    lines.swap(fileLines);
+    params.swap(fileParams);
+    return true;
+}
+
+/* written aside then renamed, an interrupted save keeps the previous checkpoint */
+bool EstimeCheckpoint::save(const std::string &path) const
+{
+    std::string tmpPath = path+".tmp";
+    std::ofstream out(tmpPath, std::ios::binary | std::ios::trunc);
+    writeValue(out, CHECKPOINT_MAGIC);
+    writeValue(out, key);
+    writeValue(out, (int32_t)order);
+    writeValue(out, (uint32_t)nlines4Group.size());
+    for (int n : nlines4Group)
+        writeValue(out, (int32_t)n);
+    writeValue(out, (uint32_t)lines.size());
+    for (const std::vector<std::pair<double, double> > &oneline : lines) {
+        writeValue(out, (uint32_t)oneline.size());
+        for (const std::pair<double, double> &point : oneline) {
+            writeValue(out, point.first);
+            writeValue(out, point.second);
+        }
+    }
+    writeValue(out, (uint32_t)params.size());
+    out.write(reinterpret_cast<const char *>(params.data()), params.size()*sizeof(double));
+    out.close();
+    if (!out) {
+        std::remove(tmpPath.c_str());
+        return false;
+    }
+    /* rename replaces the previous checkpoint in one step */
+    return std::rename(tmpPath.c_str(), path.c_str()) == 0;
+}
@@ -0,0 +1,35 @@
+#ifndef CHECKPOINT_H
+#define CHECKPOINT_H
+
+#include "linecache.h"
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+namespace DistortionModule {
+/**
+ * @brief State of an interrupted polyEstime() run.
+ *
+ * Written after the line detection and after each order of the incremental LMA,
+ * so that a new run on the same images restarts from the last finished step.
+ * The file holds the lines too: detection and optimization can run on different
+ * machines by moving it.
+ */
+struct EstimeCheckpoint
+{
+    EstimeCheckpoint() : key(0), order(0) {}
+
+    /// Fails, leaving the checkpoint unchanged, unless the file is consistent and its order
+    /// is at most \a maxOrder.
+    bool load(const std::string &path, uint64_t expectedKey, int maxOrder);
+    bool save(const std::string &path) const;
+
+    uint64_t key;                    ///< images, detection parameters and polynomial order
+    int order;                       ///< last finished order of the LMA, 0 after detection
+    std::vector<int> nlines4Group;   ///< number of lines of each image
+    LineSet lines;                   ///< lines of all images, image after image
+    std::vector<double> params;      ///< correction polynomial at \a order
+};
+}
+#endif // CHECKPOINT_H
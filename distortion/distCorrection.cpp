@@ -21,6 +21,8 @@
 
   ----------------------------------------------------------------------------*/
 #include "distCorrection.h"
+#include "linecache.h"
+#include "checkpoint.h"
 
 #include "messager.h"
 // libNumerics
@@ -46,6 +48,7 @@ static concurrent::AbstractThreadPool& DEFAULT_THREAD_POOL = QThreadpoolBridge::
 #include <algorithm>
 #include <iostream>
 #include <ctime>
+#include <cstdio>
 
 
 
@@ -358,97 +361,139 @@ bool DistortionModule::distortionCorrect(ImageGray<double> &in, ImageGray<double
     return true;
 }
 
+/* File where polyEstime saves its progress, empty when disabled */
+static std::string checkpointPath;
+
+using DistortionModule::EstimeCheckpoint;
+
+static void saveCheckpoint(const EstimeCheckpoint &checkpoint)
+{
+    if (!checkpoint.save(checkpointPath))
+        libMsg::cout<<"Cannot write checkpoint "<<checkpointPath<<libMsg::endl;
+}
+
+/* Identifies the images, detection parameters and order a checkpoint belongs to,
+ * from the line cache keys of the images */
+static uint64_t checkpointKey(const std::vector<uint64_t> &imageKeys, int order)
+{
+    uint64_t key = 14695981039346656037ULL ^ (uint64_t)order;
+    for (int i = 0; i < imageKeys.size(); ++i)
+        key = (key ^ imageKeys[i]) * 1099511628211ULL;
+    return key;
+}
+
+/* Detect the straight edges of one image, keep the ones longer than length_thresh,
+ * and smooth / sub-sample them along the curve */
+static void detect_lines(const ImageGray<BYTE> &byteImage, int length_thresh, int down_factor,
+                         DistortionModule::LineSet &lines, int &nb_detected)
+{
+    ntuple_ll p = straight_edge_points(byteImage, sigma, th_low, th_hi, min_length);
+    nb_detected = p->size;
+    std::vector<ntuple_list> kept;
+    for (int j = 0; j < (int)p->size; j++)
+        if ((int)p->list[j]->size > length_thresh)
+            kept.push_back(p->list[j]);
+    /* Gaussian convolution and sub-sampling, the curves are independent */
+    std::vector<ntuple_list> convolved(kept.size());
+    gaussian_convol_on_curves(unit_sigma, Nsigma, resampling, eliminate_border, up_factor,
+                              down_factor, kept.data(), (int)kept.size(), convolved.data());
+    free_ntuple_ll(p);
+    lines.assign(convolved.size(), std::vector<std::pair<double, double> >());
+    for (size_t j = 0; j < convolved.size(); j++) {
+        ntuple_list convolved_pts = convolved[j];
+        std::vector<std::pair<double, double> > &oneline = lines[j];
+        oneline.resize(convolved_pts->size);
+        for (unsigned int k = 0; k < convolved_pts->size; k++)
+            oneline[k] = std::make_pair(convolved_pts->values[k*convolved_pts->dim],
+                                        convolved_pts->values[k*convolved_pts->dim+1]);
+        free_ntuple_list(convolved_pts);
+    }
+}
+
+/* Everything the lines of an image depend on, besides its pixels */
+static std::vector<double> detection_params(int length_thresh, int down_factor)
+{
+    return { sigma, th_low, th_hi, min_length, (double)length_thresh, (double)down_factor,
+             unit_sigma, Nsigma, (double)resampling, (double)eliminate_border, up_factor };
+}
+
+/* Line cache key of each image, hashing every image once */
+static std::vector<uint64_t> image_keys(const std::vector<ImageGray<BYTE> > &imageList,
+                                        int length_thresh, int down_factor)
+{
+    const std::vector<double> params = detection_params(length_thresh, down_factor);
+    std::vector<uint64_t> keys(imageList.size());
+    for (int i = 0; i < imageList.size(); ++i)
+        keys[i] = DistortionModule::LineCache::key(imageList[i], params);
+    return keys;
+}
+
+/* imageKeys holds the line cache key of each image, or is empty to bypass the cache */
 template<typename T>
 static bool read_images(DistortedLines<T> &distLines,
                         const std::vector<ImageGray<BYTE> > &imageList, int length_thresh,
-                        int down_factor)
+                        int down_factor, const std::vector<uint64_t> &imageKeys)
 {
-    int w_tmp = 0, h_tmp = 0;
-    ntuple_ll point_set, p;
-    ImageGray<double> image;
-    // int length_thresh;
-    // double down_factor,
-    double x, y;
-    int w, h;
-    int total_nb_lines, total_threshed_nb_lines, threshed_nb_lines;
-    ntuple_list convolved_pts;
+    using DistortionModule::LineCache;
+    LineCache &cache = LineCache::instance();
+    const bool useCache = cache.enabled() && imageKeys.size() == imageList.size();
+    int total_nb_lines, total_threshed_nb_lines;
 
     libMsg::cout<<"There are "<<static_cast<unsigned>(imageList.size())
                 <<" input images.\n The minimal length of lines is set to "<<length_thresh
                 <<libMsg::endl;
 
-    /* initialize memory */
-    point_set = new_ntuple_ll(1);
     total_nb_lines = 0;
     total_threshed_nb_lines = 0;
 
     /* process each of the input images */
     for (int i = 0; i < imageList.size(); ++i) {
-        threshed_nb_lines = 0;
-
-        /* open image, compute edge points, close it */
-        libMsg::cout<<"start convert image "<<i+1<<"..."<<libMsg::endl;
-        imageDoubleFromImageBYTE(imageList[i], image);
-        p = straight_edge_points(image, sigma, th_low, th_hi, min_length);
-        w = image.xsize();
-        h = image.ysize();
-        if (i == 0) {
-            w_tmp = w;
-            h_tmp = h;
-        } else {
-            assert(w == w_tmp && h == h_tmp);
+        assert(imageList[i].xsize() == imageList[0].xsize()
+               && imageList[i].ysize() == imageList[0].ysize());
+        DistortionModule::LineSet lines;
+        bool hit = useCache && cache.load(imageKeys[i], lines);
+        if (hit) {
+            libMsg::cout<<"For image"<<i<<", "<<static_cast<unsigned>(lines.size())
+                        <<" lines loaded from cache.\n"<<libMsg::endl;
         }
-
-        /* copy the points set in the new image to the global set of points */
-        int count = 0;
-        for (int j = 0; j < (int)p->size; j++) {
-            if ((int)p->list[j]->size > length_thresh) {
-                add_ntuple_list(point_set, p->list[j]);
-                p->list[j] = 0;
-                count++;
-            } else {
-                threshed_nb_lines += 1;
-            }
+        if (!hit) {
+            /* compute edge points */
+            libMsg::cout<<"start convert image "<<i+1<<"..."<<libMsg::endl;
+            int nb_detected;
+            detect_lines(imageList[i], length_thresh, down_factor, lines, nb_detected);
+            int threshed_nb_lines = nb_detected - (int)lines.size();
+            libMsg::cout<<"For image"<<i<<", there are totally "<<nb_detected
+                        <<" lines detected and "<<threshed_nb_lines<<" of them are eliminated.\n"
+                        <<libMsg::endl;
+            total_nb_lines += nb_detected;
+            total_threshed_nb_lines += threshed_nb_lines;
+            if (useCache)
+                cache.store(imageKeys[i], lines);
+        } else {
+            total_nb_lines += lines.size();
         }
 
-        distLines.pushMemGroup(count);
-
-        libMsg::cout<<"For image"<<i<<", there are totally "<<p->size<<" lines detected and "
-                    <<threshed_nb_lines<<" of them are eliminated.\n"<<libMsg::endl;
-        total_nb_lines += p->size;
-        total_threshed_nb_lines += threshed_nb_lines;
-        free_ntuple_ll(p);
+        /* Save points to DistortionLines structure */
+        int firstLine = distLines.nLines;
+        distLines.pushMemGroup((int)lines.size());
+        for (int j = 0; j < (int)lines.size(); j++)
+            for (int k = 0; k < (int)lines[j].size(); k++)
+                distLines.pushPoint(firstLine+j, lines[j][k].first, lines[j][k].second);
         libMsg::abortIfAsked();
     }
     if(distLines.nLines<=0){
         libMsg::cout<<"Nothing detected in any image. Please check"<<libMsg::endl;
         return false;
     }
-    int countL = 0;
-    for (unsigned int i = 0; i < point_set->size; i++) {
-        /* Gaussian convolution and sub-sampling */
-        convolved_pts = gaussian_convol_on_curve(unit_sigma, Nsigma, resampling, eliminate_border,
-                                                 up_factor, down_factor, point_set->list[i]);
-
-        /* Save points to DistortionLines structure */
-        for (unsigned int j = 0; j < convolved_pts->size; j++) {
-            x = convolved_pts->values[j*convolved_pts->dim];
-            y = convolved_pts->values[j*convolved_pts->dim+1];
-            distLines.pushPoint(countL, x, y);
-        }
-        countL++;
-    }
     libMsg::cout<<"Totally there are "<<total_nb_lines<<" lines detected and "
                 <<total_threshed_nb_lines<< " of them are eliminated.\n"<<libMsg::endl;
-    /* free memory */
-    free_ntuple_ll(point_set);
-    free_ntuple_list(convolved_pts);
     return true;
 }
 
 template<typename T>
 static libNumerics::vector<T> incLMA(DistortedLines<T> &distLines, const int order,
-                                     const int inc_order, T xp, T yp)
+                                     const int inc_order, T xp, T yp,
+                                     DistortionModule::EstimeCheckpoint *checkpoint = 0)
 {
     int sizexy = (order + 1) * (order + 2) / 2;
     vector<T> paramsX = vector<T>::zeros(sizexy);
@@ -462,7 +507,15 @@ static libNumerics::vector<T> incLMA(DistortedLines<T> &distLines, const int ord
     libMsg::cout<<"initial RMSE / maximum: "<<rmse<<" / "<<rmse_max<<" \n"<<libMsg::endl;
     const int beginOrder = 3;
     vector<T> midParams(1);
-    for (int i = beginOrder; i <= order; i = i+inc_order) {
+    int i = beginOrder;
+    if (checkpoint && checkpoint->order >= beginOrder) {
+        libMsg::cout<<"Resume after order "<<checkpoint->order<<libMsg::endl;
+        midParams = vector<T>(checkpoint->params.size());
+        for (int k = 0; k < midParams.size(); k++)
+            midParams[k] = checkpoint->params[k];
+        i = checkpoint->order + inc_order;
+    }
+    for (; i <= order; i = i+inc_order) {
         int sizebc = (i+1) * (i+2) / 2;
         vector<T> b = vector<T>::zeros(sizebc);
         vector<T> c = vector<T>::zeros(sizebc);
@@ -489,6 +542,14 @@ static libNumerics::vector<T> incLMA(DistortedLines<T> &distLines, const int ord
                                  midParams.copyRef(sizebc, sizebc+sizebc-1), i, i, xp, yp);
         libMsg::cout<<"When order = "<<i<<" :"<<libMsg::endl;
         libMsg::cout<<"RMSE / maximum: "<<rmse<<" / "<<rmse_max<<" \n"<<libMsg::endl;
+        if (checkpoint) {
+            checkpoint->order = i;
+            checkpoint->params.resize(midParams.size());
+            for (int k = 0; k < midParams.size(); k++)
+                checkpoint->params[k] = midParams[k];
+            saveCheckpoint(*checkpoint);
+        }
+        libMsg::abortIfAsked();
     }
     libMsg::cout<<"\n Iterative linear minimization step: \n"<<libMsg::endl;
     T diff = 100;
@@ -526,9 +587,24 @@ static vector<T> polyInv(const vector<T> &poly_params, const int degX, const int
 {
     int sizex = (degX + 1) * (degX + 2) / 2;
     int sizey = (degY + 1) * (degY + 2) / 2;
-    return getParamsInv(poly_params.copyRef(0, sizex-1), poly_params.copyRef(sizex,
-                                                                             sizex+sizey-1), degX, degY, wi, he, xp,
-                        yp);
+    T rmsError, maxError;
+    vector<T> poly_params_inv = getParamsInv(poly_params.copyRef(0, sizex-1),
+                                             poly_params.copyRef(sizex, sizex+sizey-1), degX, degY,
+                                             wi, he, xp, yp, rmsError, maxError,
+                                             &DEFAULT_THREAD_POOL);
+    libMsg::cout<<"Round trip error of the inverse polynomial (RMS / max): "<<rmsError<<" / "
+                <<maxError<<" pixels"<<libMsg::endl;
+    return poly_params_inv;
+}
+
+void DistortionModule::setLineCache(const std::string &dir, size_t maxBytes)
+{
+    LineCache::instance().configure(dir, maxBytes);
+}
+
+void DistortionModule::setCheckpoint(const std::string &path)
+{
+    checkpointPath = path;
 }
 
 bool DistortionModule::polyEstime(const std::vector<ImageGray<BYTE> > &list,
@@ -552,8 +628,36 @@ bool DistortionModule::polyEstime(const std::vector<ImageGray<BYTE> > &list,
     }
     int min_length = std::min(w, h)*0.3;
     DistortedLines<double> distLines;
-    if(!read_images<double>(distLines, list, min_length, 60))
+    std::vector<uint64_t> imageKeys;
+    if (LineCache::instance().enabled() || !checkpointPath.empty())
+        imageKeys = image_keys(list, min_length, 60);
+    EstimeCheckpoint checkpoint;
+    if (!checkpointPath.empty()) {
+        checkpoint.key = checkpointKey(imageKeys, order);
+        if (checkpoint.load(checkpointPath, checkpoint.key, order)) {
+            libMsg::cout<<"Lines loaded from checkpoint "<<checkpointPath<<libMsg::endl;
+            for (int i = 0, line = 0; i < checkpoint.nlines4Group.size(); ++i) {
+                distLines.pushMemGroup(checkpoint.nlines4Group[i]);
+                for (int j = 0; j < checkpoint.nlines4Group[i]; ++j, ++line)
+                    for (int k = 0; k < checkpoint.lines[line].size(); ++k)
+                        distLines.pushPoint(line, checkpoint.lines[line][k].first,
+                                            checkpoint.lines[line][k].second);
+            }
+        } else {
+            if (!read_images<double>(distLines, list, min_length, 60, imageKeys))
+                return false;
+            checkpoint.order = 0;
+            checkpoint.nlines4Group = distLines.nlines4Group;
+            checkpoint.lines.resize(distLines.nLines);
+            for (int i = 0; i < distLines.nLines; ++i)
+                for (int k = 0; k < distLines._line[i].sizeLine(); ++k)
+                    checkpoint.lines[i].push_back(std::make_pair(distLines._line[i].x(k),
+                                                                 distLines._line[i].y(k)));
+            saveCheckpoint(checkpoint);
+        }
+    } else if (!read_images<double>(distLines, list, min_length, 60, imageKeys)) {
         return false;
+    }
 
     // store lines detected in detectedLines
     int count = 0;
@@ -577,7 +681,10 @@ bool DistortionModule::polyEstime(const std::vector<ImageGray<BYTE> > &list,
     double xp = (double)w/2+0.2, yp = (double)h/2+0.2; /* +0.2 - to avoid integers */
     const int inc = 2; /* increment; only odd orders will be taken */
     libMsg::cout<<"Calculate Polynomial"<<libMsg::endl;
-    vector<double> poly_params = incLMA <double>(distLines, order, inc, xp, yp);
+    vector<double> poly_params = incLMA <double>(distLines, order, inc, xp, yp,
+                                                 checkpointPath.empty() ? 0 : &checkpoint);
+    if (!checkpointPath.empty())
+        std::remove(checkpointPath.c_str());
 
     /* Get an inverse polynomial */
     libMsg::cout<<"Inverse Polynomial ..."<<libMsg::endl;
@@ -7,11 +7,20 @@
 
 #include <vector>
 #include <utility>
+#include <string>
 namespace DistortionModule {
 bool distortionCorrect_RGB(ImageRGB<double> &in, ImageRGB<double> &out, const Bi<std::vector<double> > &polynome);
 
 bool distortionCorrect(ImageGray<double> &in, ImageGray<double> &out, const Bi<std::vector<double> > &polynome);
 
+/* Directory where the lines detected in each image are kept between runs,
+ * an empty dir disables the cache */
+void setLineCache(const std::string &dir, size_t maxBytes);
+
+/* File where polyEstime saves the detected lines and each finished order, and from which a
+ * run on the same images resumes. Removed once the estimation succeeds; empty path disables it */
+void setCheckpoint(const std::string &path);
+
 bool polyEstime(const std::vector<ImageGray<BYTE> > &list, std::vector<double> &polynome, int order,
                 std::vector<std::vector<std::vector<std::pair<double, double> > > > &detectedLines);
 }
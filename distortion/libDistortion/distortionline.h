@@ -2,6 +2,11 @@
 #define DISTORTION_H
 
 #include "LMmin.h"
+#include "../../commondefs.h"
+// libConcurrent
+#include "abstractthreadpool.h"
+#include "stlCallable.h"
+#include <memory>
 
 template <typename T> libNumerics::vector<T> bicubicDistModel(const libNumerics::vector<T>& completeParams, const libNumerics::matrix<T>& coefTerm);
 
@@ -9,12 +14,15 @@ template <typename T> libNumerics::vector<T> bicubicDistModel(const libNumerics:
 template <typename T>
 class LineData {
 public:
-	LineData() { nPoints = 0; }
+	LineData() { nPoints = 0; _monoDeg = -1; }
 
 private: 
 	std::vector<T> _pointX, _pointY; ///< Vectors for x and y coordinates.
 	int nPoints;
     libNumerics::matrix<T> _coefTermX, _coefTermY; ///< Matrices for keeping constant values of polynomial.
+    libNumerics::matrix<T> _monomials; ///< All monomials up to degree \a _monoDeg, same row order as coefTerm.
+    int _monoDeg; ///< Degree of \a _monomials, -1 when it must be recomputed.
+    T _monoXp, _monoYp; ///< Center used for \a _monomials.
 
 public:
 	int sizeLine() { return nPoints; }
@@ -26,9 +34,10 @@ public:
     libNumerics::vector<T> residuals(const libNumerics::vector<T>& paramsX, const libNumerics::vector<T>& paramsY) const;
     T RMSE(const libNumerics::vector<T>& paramsX, const libNumerics::vector<T>& paramsY) const;
 	void coefTermsCalc(int degX, int degY, T xp, T yp, T scale = 0);
+    libNumerics::matrix<T> coefTerms(int deg, T xp, T yp);
 
 private:
-    void coefTermFill(libNumerics::matrix<T>& coefTerm, int deg, T x, T y) const;
+    void monomialsCalc(int deg, T xp, T yp);
 }; // LineData
 
 template <typename T>
@@ -45,7 +54,7 @@ public:
 	int totalPointsNumber();
 	void pushMemGroup(int numLines);
 	void pullMemoryLine(void);
-	void pushPoint(int idxLine, T valX, T valY) { _line[idxLine].pushPoint(valX, valY); } ///< Add a point to a line with index \a idxLine.
+	void pushPoint(int idxLine, T valX, T valY) { _line[idxLine].pushPoint(valX, valY); _normLines.reset(); } ///< Add a point to a line with index \a idxLine.
     T RMSE(const libNumerics::vector<T>& paramsX, const libNumerics::vector<T>& paramsY, int degX, int degY, T xp, T yp);
     T RMSE_max(const libNumerics::vector<T>& paramsX, const libNumerics::vector<T>& paramsY, int degX, int degY,  T xp, T yp);
     libNumerics::vector<T> correctionLMA(libNumerics::vector<T>& paramsX, libNumerics::vector<T>& paramsY, libNumerics::vector<int>& flagX, libNumerics::vector<int>& flagY,
@@ -55,7 +64,10 @@ public:
 
 private:
     void estimatedThetas(const libNumerics::vector<T>& paramsX, const libNumerics::vector<T>& paramsY, libNumerics::vector<T>& alpha, libNumerics::vector<T>& beta, int degX, int degY, T xp, T yp);
-	void normalization(DistortedLines<T>& normDistLines, T& scale, T xp, T yp);
+	DistortedLines<T>& normalization(T& scale, T xp, T yp);
+
+    std::shared_ptr< DistortedLines<T> > _normLines; ///< Normalized lines kept between orders, with their monomial tables.
+    T _normScale, _normXp, _normYp; ///< Parameters used for \a _normLines.
 }; // DistortionLines
 
 /// Class to refine the distortion polynomial parameters.
@@ -68,7 +80,7 @@ public:
 private:
 	int orderX, orderY;
     libNumerics::vector<int> flagX, flagY;
-	DistortedLines<T> distLines;
+	DistortedLines<T>& distLines;
 
 public:
     virtual void modelData(const libNumerics::vector<T>& P, libNumerics::vector<T>& ymodel) const;
@@ -78,13 +90,22 @@ public:
 template <typename T> void denormalization(libNumerics::vector<T>& denormX, libNumerics::vector<T>& denormY, const libNumerics::vector<T>& normX, const libNumerics::vector<T>& normY,
 	T scaleX, T scaleY, int orderX, int orderY);
 
+template <typename T> void monomialsFill(libNumerics::matrix<T>& coefTerm, int deg, const T* x, const T* y, int n, T xp, T yp);
+
 /// Returns a correction polynomial for the given distortion one.
 template <typename T>
-libNumerics::vector<T> getParamsInv(const libNumerics::vector<T>& paramsX, const libNumerics::vector<T>& paramsY, int degX, int degY, int w, int h, T xp, T yp);
+libNumerics::vector<T> getParamsInv(const libNumerics::vector<T>& paramsX, const libNumerics::vector<T>& paramsY, int degX, int degY, int w, int h, T xp, T yp,
+    T& rmsError, T& maxError, concurrent::AbstractThreadPool* thPool = 0);
 
 /// Returns a correction polynomial for the given corrected and distorted coordinates.
 template <typename T>
-libNumerics::vector<T> getParamsCorrection(libNumerics::vector<T>& x_corr, libNumerics::vector<T>& y_corr, libNumerics::vector<T>& x_dist, libNumerics::vector<T>& y_dist, int degX, int degY, T xp, T yp);
+libNumerics::vector<T> getParamsCorrection(libNumerics::vector<T>& x_corr, libNumerics::vector<T>& y_corr, libNumerics::vector<T>& x_dist, libNumerics::vector<T>& y_dist, int degX, int degY, T xp, T yp,
+    concurrent::AbstractThreadPool* thPool = 0);
+
+/// Distance between the points of a grid and their image by the polynomial followed by its inverse.
+template <typename T>
+void roundTripError(const libNumerics::vector<T>& paramsX, const libNumerics::vector<T>& paramsY, const libNumerics::vector<T>& paramsInv, int degX, int degY, int w, int h, T xp, T yp,
+    int nGrid, T& rmsError, T& maxError);
 
 /*
  *
@@ -106,6 +127,26 @@ libNumerics::vector<T> bicubicDistModel(const libNumerics::vector<T>& completePa
     return coefTerm.t() * completeParams;
 }
 
+/// Monomials (x-xp)^(ii-j)*(y-yp)^j of degree \a deg and lower, highest degree first,
+/// one column per point. Powers are built by running products, not pow().
+template <typename T>
+void monomialsFill(libNumerics::matrix<T>& coefTerm, int deg, const T* x, const T* y, int n, T xp, T yp)
+{
+    coefTerm = libNumerics::matrix<T>((deg + 1) * (deg + 2) / 2, n);
+    std::vector<T> powX(deg+1), powY(deg+1);
+    for (int k = 0; k < n; k++) {
+        powX[0] = powY[0] = 1;
+        for (int d = 1; d <= deg; d++) {
+            powX[d] = powX[d-1] * (x[k]-xp);
+            powY[d] = powY[d-1] * (y[k]-yp);
+        }
+        int idx = 0;
+        for (int ii = deg; ii >= 0; ii--)
+            for (int j = 0; j <= ii; j++)
+                coefTerm(idx++, k) = powX[ii-j] * powY[j];
+    }
+}
+
 /// One point with coordinates \a x and \a y is added to the line.
 template <typename T>
 void LineData<T>::pushPoint(const T x, const T y)
@@ -113,6 +154,7 @@ void LineData<T>::pushPoint(const T x, const T y)
     _pointX.push_back(x);
     _pointY.push_back(y);
     nPoints++;
+    _monoDeg = -1;
 }
 
 /// Outputs sine and cosine for the line.
@@ -233,29 +275,35 @@ T LineData<T>::RMSE(const libNumerics::vector<T>& paramsX, const libNumerics::ve
 template <typename T>
 void LineData<T>::coefTermsCalc(int degX, int degY, T xp, T yp, T scale)
 {
-    int sizex = (degX + 1) * (degX + 2) / 2;
-    int sizey = (degY + 1) * (degY + 2) / 2;
-    _coefTermX = libNumerics::matrix<T>(sizex, nPoints);
-    _coefTermY = libNumerics::matrix<T>(sizey, nPoints);
-    if (scale == 0) {
-        coefTermFill(_coefTermX, degX, xp, yp);
-        coefTermFill(_coefTermY, degY, xp, yp); }
-    else {
-        coefTermFill(_coefTermX, degX, 0, 0);
-        coefTermFill(_coefTermY, degY, 0, 0); }
+    if (scale != 0)
+        xp = yp = 0;
+    _coefTermX = coefTerms(degX, xp, yp);
+    _coefTermY = coefTerms(degY, xp, yp);
 }
 
+/// Monomials x^(ii-j)*y^j of degree \a deg and lower, centered on (\a xp, \a yp).
+/// Rows follow the coefficient order of the polynomial (highest degree first),
+/// so the terms of a lower order are the last rows of a higher order table:
+/// they are sliced out of one table computed up to MAX_POLYNOME_ORDER.
 template <typename T>
-void LineData<T>::coefTermFill(libNumerics::matrix<T>& coefTerm, int deg, T x, T y) const
+libNumerics::matrix<T> LineData<T>::coefTerms(int deg, T xp, T yp)
 {
-    int idx = 0;
-    for (int ii = deg; ii >= 0; ii--) {
-        for (int j = 0; j <= ii; j++){
-            for (int k = 0; k < nPoints; k++)
-                coefTerm(idx, k) = pow(_pointX[k]-x, ii-j) * pow(_pointY[k]-y, j);
-            idx++;
-        }
-    }
+    if (_monoDeg < deg || _monoXp != xp || _monoYp != yp)
+        monomialsCalc(std::max(deg, MAX_POLYNOME_ORDER), xp, yp);
+    int size = (deg + 1) * (deg + 2) / 2;
+    int sizeMono = _monomials.nrow();
+    if (size == sizeMono)
+        return _monomials;
+    return _monomials.copyRows(sizeMono-size, sizeMono-1);
+}
+
+template <typename T>
+void LineData<T>::monomialsCalc(int deg, T xp, T yp)
+{
+    monomialsFill(_monomials, deg, _pointX.data(), _pointY.data(), nPoints, xp, yp);
+    _monoDeg = deg;
+    _monoXp = xp;
+    _monoYp = yp;
 }
 
 /// Number of all the points of all the lines.
@@ -276,6 +324,7 @@ void DistortedLines<T>::pushMemGroup(int numLines)
     nlines4Group.push_back(numLines);
     nLines += numLines;
     _line.resize(nLines);
+    _normLines.reset();
 }
 
 /// Delete a line from a group.
@@ -285,6 +334,7 @@ void DistortedLines<T>::pullMemoryLine(void)
     nlines4Group[nlines4Group.size()-1]--;
     nLines--;
     _line.resize(nLines);
+    _normLines.reset();
 }
 
 template <typename T>
@@ -319,8 +369,7 @@ libNumerics::vector<T> DistortedLines<T>::correctionLMA(libNumerics::vector<T>&
     int sizex = paramsX.size();
     int sizey = paramsY.size();
     T scale = 0;
-    DistortedLines<T> normDistLines;
-    normalization(normDistLines, scale, xp, yp);
+    DistortedLines<T>& normDistLines = normalization(scale, xp, yp);
     libNumerics::vector<T> denormX(sizex), denormY(sizey);
     denormalization(denormX, denormY, paramsX, paramsY, 1/scale, 1/scale, degX, degY);
     int sizeP = sizex + sizey;
@@ -355,8 +404,7 @@ libNumerics::vector<T> DistortedLines<T>::verification(const libNumerics::vector
     libNumerics::vector<T> alpha(nLines), beta(nLines);
     estimatedThetas(paramsX, paramsY, alpha, beta, b_order, c_order, xp, yp); // calculates sin(theta) and cos(theta) -> alpha and beta
     T scale = 1;
-    DistortedLines<T> normDistLines;
-    normalization(normDistLines, scale, xp, yp);
+    DistortedLines<T>& normDistLines = normalization(scale, xp, yp);
     int idx = 0;
     for (int ii = b_order; ii >= 0; ii--) {
         for (int jj = 1; jj <= ii+1; jj++) {
@@ -380,24 +428,12 @@ libNumerics::vector<T> DistortedLines<T>::verification(const libNumerics::vector
         int prev_nb_lines = 0;
         if (i != 0) prev_nb_lines = i;
 
-        LineData<T> one_line = normDistLines._line[prev_nb_lines];
+        LineData<T>& one_line = normDistLines._line[prev_nb_lines];
         int nb_samples = one_line.sizeLine();
         nSamples += nb_samples;
 
-        coefTermB[i] = libNumerics::matrix<T>::zeros(sizex, nb_samples);
-        coefTermC[i] = libNumerics::matrix<T>::zeros(sizey, nb_samples);
-        idx = 0;
-        for (int ii = b_order; ii >= 0; ii--) {
-            for (int jj = 1; jj <= ii+1; jj++) {
-                for (int k = 0; k < one_line.sizeLine(); k++)
-                    coefTermB[i](idx, k) = pow(one_line.x(k), ii-(jj-1)) * pow(one_line.y(k), jj-1);
-                idx++; } }
-        idx = 0;
-        for (int ii = c_order; ii >= 0; ii--) {
-            for (int jj = 1; jj <= ii+1; jj++) {
-                for (int k = 0; k < one_line.sizeLine(); k++)
-                    coefTermC[i](idx, k) = pow(one_line.x(k), ii-(jj-1)) * pow(one_line.y(k), jj-1);
-                idx++; } }
+        coefTermB[i] = one_line.coefTerms(b_order, 0, 0);
+        coefTermC[i] = one_line.coefTerms(c_order, 0, 0);
 
         libNumerics::vector<T> tmp1 = libNumerics::vector<T>::zeros(nLines);
         tmp1[coefMatIdx] = -nb_samples;
@@ -569,26 +605,39 @@ void DistortedLines<T>::estimatedThetas(const libNumerics::vector<T>& paramsX, c
         _line[i].theta(paramsX, paramsY, alpha[i], beta[i]); }
 }
 
+/// Lines centered on (\a xp, \a yp) and scaled to unit mean radius.
+/// The result is kept until the lines change, so that successive orders
+/// of the LMA reuse the same normalized points and monomial tables.
 template <typename T>
-void DistortedLines<T>::normalization(DistortedLines<T>& normDistLines, T& scale, T xp, T yp)
+DistortedLines<T>& DistortedLines<T>::normalization(T& scale, T xp, T yp)
 {
+    if (_normLines && _normXp == xp && _normYp == yp) {
+        scale = _normScale;
+        return *_normLines;
+    }
     T dist = 0;
     for (int i = 0; i < nLines; i++) {
         for (int j = 0; j < _line[i].sizeLine(); j++)
             dist += std::sqrt( pow(_line[i].x(j) - xp, 2) + pow(_line[i].y(j) - yp, 2) ); }
     scale = dist / totalPointsNumber();
-    normDistLines.pushMemGroup(nLines);
+    std::shared_ptr< DistortedLines<T> > normDistLines = std::make_shared< DistortedLines<T> >();
+    normDistLines->pushMemGroup(nLines);
     for (int i = 0; i < nLines; i++) {
         for (int j = 0; j < _line[i].sizeLine(); j++)
-            normDistLines.pushPoint(i, (_line[i].x(j) - xp) / scale , (_line[i].y(j) - yp) / scale ); }
+            normDistLines->pushPoint(i, (_line[i].x(j) - xp) / scale , (_line[i].y(j) - yp) / scale ); }
+    _normLines = normDistLines;
+    _normScale = scale;
+    _normXp = xp;
+    _normYp = yp;
+    return *_normLines;
 }
 
 template <typename T>
 LMRectifyDistortion<T>::LMRectifyDistortion(int oX, int oY, libNumerics::vector<int>& flagx, libNumerics::vector<int>& flagy, DistortedLines<T>& normDistLines, T scale, T xp, T yp)
+    : distLines(normDistLines)
 {
     orderX = oX; orderY = oY;
     flagX = flagx; flagY = flagy;
-    distLines = normDistLines;
     for (int i = 0; i < distLines.nLines; i++) distLines._line[i].coefTermsCalc(orderX, orderY, xp, yp, scale);
 }
 
@@ -632,9 +681,26 @@ void denormalization(libNumerics::vector<T>& denormX, libNumerics::vector<T>& de
     }
 }
 
+/// Rows \a first, \a first+\a stride, ... of the upper triangle of coefTerm*coefTerm^t and of
+/// coefTerm*target, written at (\a offset, \a offset) of the normal equations.
+template <typename T>
+void normalEquationRows(const libNumerics::matrix<T>* coefTerm, const libNumerics::vector<T>* target,
+                        libNumerics::matrix<T>* coef_mat, libNumerics::vector<T>* m, int offset, int first, int stride)
+{
+    int size = coefTerm->nrow();
+    for (int i = first; i < size; i += stride) {
+        libNumerics::vectorRef<T> row = coefTerm->rowRef(i);
+        for (int j = i; j < size; j++)
+            (*coef_mat)(offset+i, offset+j) = row * coefTerm->rowRef(j);
+        (*m)[offset+i] = *target * row;
+    }
+}
+
 /// Returns a correction polynomial for the given corrected and distorted coordinates.
+/// The normal equations are assembled on \a thPool when it is given.
 template <typename T>
-libNumerics::vector<T> getParamsCorrection(libNumerics::vector<T>& x_corr, libNumerics::vector<T>& y_corr, libNumerics::vector<T>& x_dist, libNumerics::vector<T>& y_dist, int degX, int degY, T xp, T yp)
+libNumerics::vector<T> getParamsCorrection(libNumerics::vector<T>& x_corr, libNumerics::vector<T>& y_corr, libNumerics::vector<T>& x_dist, libNumerics::vector<T>& y_dist, int degX, int degY, T xp, T yp,
+    concurrent::AbstractThreadPool* thPool)
 {
     int sizex = (degX+1)*(degX+2)/2;
     int sizey = (degY+1)*(degY+2)/2;
@@ -646,44 +712,36 @@ libNumerics::vector<T> getParamsCorrection(libNumerics::vector<T>& x_corr, libNu
     norm_xy = std::sqrt(norm_xy);
     x_dist_rad  /= norm_xy; y_dist_rad  /= norm_xy;
 
-    libNumerics::matrix<T> coefTermX(sizex, lenxy), coefTermY(sizey, lenxy);
-    int idx = 0;
-    for (int ii = degX; ii >= 0; ii--) {
-        for (int j = 0; j <= ii; j++)  {
-            for (int k = 0; k < lenxy; k++)
-                coefTermX(idx, k) = pow(x_dist_rad[k], ii-j) * pow(y_dist_rad[k], j);
-            idx++;
-        } 	}
-    idx = 0;
-    for (int ii = degY; ii >= 0; ii--) {
-        for (int j = 0; j <= ii; j++)  {
-            for (int k = 0; k < lenxy; k++)
-                coefTermY(idx, k) = pow(x_dist_rad[k], ii-j) * pow(y_dist_rad[k], j);
-            idx++;
-        } 	}
+    libNumerics::matrix<T> coefTermX, coefTermY;
+    monomialsFill(coefTermX, degX, &x_dist_rad[0], &y_dist_rad[0], lenxy, (T)0, (T)0);
+    if (degY == degX)
+        coefTermY = coefTermX;
+    else
+        monomialsFill(coefTermY, degY, &x_dist_rad[0], &y_dist_rad[0], lenxy, (T)0, (T)0);
 
     int sizexy = sizex+sizey;
     libNumerics::matrix<T> coef_mat = libNumerics::matrix<T>::zeros(sizexy, sizexy);
     libNumerics::vector<T> m = libNumerics::vector<T>::zeros(sizexy);
-    int count_i = 0;
-    for (int i = 0; i < sizex; i++) {
-        int count_j = 0;
-        for (int j = 0; j < sizex; j++) {
-            coef_mat(count_i, count_j) = coefTermX.rowRef(i) * coefTermX.rowRef(j);
-            count_j++;
+    if (thPool) {
+        const int nTasks = 8;
+        std::vector<concurrent::Future<void>*> ftrs;
+        for (int t = 0; t < nTasks; t++) {
+            ftrs.push_back(concurrent::asyncInvoke(*thPool, &normalEquationRows<T>,
+                (const libNumerics::matrix<T>*)&coefTermX, (const libNumerics::vector<T>*)&x_corr_rad, &coef_mat, &m, 0, t, nTasks));
+            ftrs.push_back(concurrent::asyncInvoke(*thPool, &normalEquationRows<T>,
+                (const libNumerics::matrix<T>*)&coefTermY, (const libNumerics::vector<T>*)&y_corr_rad, &coef_mat, &m, sizex, t, nTasks));
         }
-        m[count_i] = x_corr_rad * coefTermX.rowRef(i);
-        count_i++;
+        for (int t = 0; t < ftrs.size(); t++) {
+            ftrs[t]->getResult();
+            delete ftrs[t];
+        }
+    } else {
+        normalEquationRows(&coefTermX, &x_corr_rad, &coef_mat, &m, 0, 0, 1);
+        normalEquationRows(&coefTermY, &y_corr_rad, &coef_mat, &m, sizex, 0, 1);
     }
-
-    count_i = 0;
-    for (int i = 0; i < sizey; i++) {
-        int count_j = 0;
-        for (int j = 0; j < sizey; j++) {
-            coef_mat(sizex+count_i, sizex+count_j) = coefTermY.rowRef(i) * coefTermY.rowRef(j);
-            count_j++; }
-        m[sizex+count_i] = y_corr_rad * coefTermY.rowRef(i);
-        count_i++; 	}
+    for (int i = 0; i < sizexy; i++)
+        for (int j = 0; j < i; j++)
+            coef_mat(i, j) = coef_mat(j, i);
 
     libNumerics::matrix<T> normalization_mat1 = libNumerics::matrix<T>::zeros(sizexy, sizexy);
     libNumerics::matrix<T> inv_normalization_mat1 = libNumerics::matrix<T>::zeros(sizexy, sizexy);
@@ -714,43 +772,89 @@ libNumerics::vector<T> getParamsCorrection(libNumerics::vector<T>& x_corr, libNu
     return denorm_paramsInv;
 }
 
-/// Returns a correction polynomial for the given distortion one.
+/// Regular grid of \a nx x \a ny points spanning the image.
 template <typename T>
-libNumerics::vector<T> getParamsInv(const libNumerics::vector<T>& paramsX, const libNumerics::vector<T>& paramsY, int degX, int degY, int w, int h, T xp, T yp)
+void imageGrid(libNumerics::vector<T>& x, libNumerics::vector<T>& y, int nx, int ny, int w, int h)
 {
-    int sizex = paramsX.size();
-    int sizey = paramsY.size();
-    // grid of coordinates with step
-    const int stepX = 0.007*w, stepY = 0.007*h;
-    int divresultx = w/stepX;
-    int divresulty = h/stepY;
-    int lenxy = divresultx * divresulty;
-    libNumerics::vector<T> x_corr(lenxy), y_corr(lenxy);
+    x = libNumerics::vector<T>(nx*ny);
+    y = libNumerics::vector<T>(nx*ny);
     int idx = 0;
-    for (int i = 0; i < divresulty; i++) {
-        for (int j = 0; j < divresultx; j++) {
-            x_corr[idx] = j*stepX;
-            y_corr[idx] = i*stepY;
-            idx++; 	} }
-    libNumerics::matrix<T> coefTermX(sizex, lenxy), coefTermY(sizey, lenxy);
-    idx = 0;
-    for (int ii = degX; ii >= 0; ii--) {
-        for (int j = 0; j <= ii; j++)  {
-            for (int k = 0; k < lenxy; k++)
-                coefTermX(idx, k) = pow( x_corr[k]-xp, ii-j) * pow(y_corr[k]-yp, j);
-            idx++;
-        } 	}
-    idx = 0;
-    for (int ii = degY; ii >= 0; ii--) {
-        for (int j = 0; j <= ii; j++)  {
-            for (int k = 0; k < lenxy; k++)
-                coefTermY(idx, k) = pow(x_corr[k]-xp, ii-j) * pow(y_corr[k]-yp, j);
-            idx++;
-        } 	}
+    for (int i = 0; i < ny; i++) {
+        for (int j = 0; j < nx; j++) {
+            x[idx] = (T)(w-1) * j / (nx-1);
+            y[idx] = (T)(h-1) * i / (ny-1);
+            idx++; } }
+}
+
+/// Value at (\a x, \a y) of the polynomial \a params of degree \a deg, starting at index \a first.
+/// \a powX and \a powY hold the powers of the centered coordinates.
+template <typename T>
+T polyValue(const libNumerics::vector<T>& params, int first, int deg, const std::vector<T>& powX, const std::vector<T>& powY)
+{
+    T value = 0;
+    int idx = first;
+    for (int ii = deg; ii >= 0; ii--)
+        for (int j = 0; j <= ii; j++)
+            value += params[idx++] * powX[ii-j] * powY[j];
+    return value;
+}
+
+template <typename T>
+void powersFill(std::vector<T>& powX, std::vector<T>& powY, T x, T y)
+{
+    powX[0] = powY[0] = 1;
+    for (int d = 1; d < powX.size(); d++) {
+        powX[d] = powX[d-1] * x;
+        powY[d] = powY[d-1] * y;
+    }
+}
+
+template <typename T>
+void roundTripError(const libNumerics::vector<T>& paramsX, const libNumerics::vector<T>& paramsY, const libNumerics::vector<T>& paramsInv, int degX, int degY, int w, int h, T xp, T yp,
+    int nGrid, T& rmsError, T& maxError)
+{
+    int sizex = paramsX.size();
+    libNumerics::vector<T> x, y;
+    imageGrid(x, y, nGrid, nGrid, w, h);
+    int lenxy = x.size();
+    std::vector<T> powX(std::max(degX, degY)+1), powY(std::max(degX, degY)+1);
+    rmsError = maxError = 0;
+    for (int k = 0; k < lenxy; k++) {
+        powersFill(powX, powY, x[k]-xp, y[k]-yp);
+        T x_dist = polyValue(paramsX, 0, degX, powX, powY);
+        T y_dist = polyValue(paramsY, 0, degY, powX, powY);
+        powersFill(powX, powY, x_dist, y_dist);
+        T dx = polyValue(paramsInv, 0, degX, powX, powY) + xp - x[k];
+        T dy = polyValue(paramsInv, sizex, degY, powX, powY) + yp - y[k];
+        T err2 = dx*dx + dy*dy;
+        rmsError += err2;
+        maxError = std::max(maxError, err2);
+    }
+    rmsError = std::sqrt(rmsError / lenxy);
+    maxError = std::sqrt(maxError);
+}
+
+/// Returns a correction polynomial for the given distortion one, fitted on a grid of 1/0.007
+/// points per side. \a rmsError and \a maxError receive its round trip error, measured on a
+/// grid with one more point per side, whose inner points fall between the fitting ones.
+template <typename T>
+libNumerics::vector<T> getParamsInv(const libNumerics::vector<T>& paramsX, const libNumerics::vector<T>& paramsY, int degX, int degY, int w, int h, T xp, T yp,
+    T& rmsError, T& maxError, concurrent::AbstractThreadPool* thPool)
+{
+    const int nGrid = 1/0.007, validationGrid = nGrid+1;
+    libNumerics::vector<T> x_corr, y_corr;
+    imageGrid(x_corr, y_corr, nGrid, nGrid, w, h);
+    int lenxy = x_corr.size();
+    libNumerics::matrix<T> coefTermX, coefTermY;
+    monomialsFill(coefTermX, degX, &x_corr[0], &y_corr[0], lenxy, xp, yp);
+    if (degY != degX)
+        monomialsFill(coefTermY, degY, &x_corr[0], &y_corr[0], lenxy, xp, yp);
     libNumerics::vector<T> x_dist = bicubicDistModel(paramsX, coefTermX) + xp;
-    libNumerics::vector<T> y_dist = bicubicDistModel(paramsY, coefTermY) + yp;
+    libNumerics::vector<T> y_dist = bicubicDistModel(paramsY, degY != degX ? coefTermY : coefTermX) + yp;
 
-    return getParamsCorrection(x_corr, y_corr, x_dist, y_dist, degX, degY, xp, yp);
+    libNumerics::vector<T> paramsInv = getParamsCorrection(x_corr, y_corr, x_dist, y_dist, degX, degY, xp, yp, thPool);
+    roundTripError(paramsX, paramsY, paramsInv, degX, degY, w, h, xp, yp, validationGrid, rmsError, maxError);
+    return paramsInv;
 }
 
 
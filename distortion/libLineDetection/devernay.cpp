@@ -36,6 +36,14 @@
 
 #include "ntuple.h"
 #include "gauss.h"
+// libConcurrent
+#include "abstractthreadpool.h"
+#include "stlCallable.h"
+#include "qthreadpoolbridge.h"
+static concurrent::AbstractThreadPool& DEFAULT_THREAD_POOL = QThreadpoolBridge::DEFAULT;
+
+#include <vector>
+#include <algorithm>
 
 /*----------------------------------------------------------------------------*/
 /** Add a 2-tuple to an 2-tuple list.
@@ -59,84 +67,158 @@ static void add_2tuple(ntuple_list out, double v1, double v2)
 }
 
 /*----------------------------------------------------------------------------*/
-/** Devernay sub-pixel edge detector.
+/** Local maximum of the gradient kept as a possible edge point.
  */
-ntuple_list devernay(ImageGray<double> &image, double sigma, double th_low, double th_hi)
+struct edge_candidate
 {
-    ntuple_list out = new_ntuple_list(2);
-
-    double mod, mod_up_grad, mod_down_grad, dx, dy, Dx, Dy, weight, off;
-    unsigned int x, y, xx, yy, xsize, ysize, i;
-    int i_up, j_up, i_down, j_down;
+    unsigned int pos;  /* x*ysize+y, so that candidates sort column by column */
+    bool hi;           /* gradient above the high Canny threshold */
+    double x, y;       /* sub-pixel position */
+};
 
-    /* check input */
-    if (!image.isValid())
-        libMsg::error("devernay: invalid input image.");
-    if (sigma <= 0.0) libMsg::error("devernay: sigma must be positive.");
-    xsize = image.xsize();
-    ysize = image.ysize();
-
-    /* get memory */
-    ImageGray<double> gradx(xsize, ysize, 0.0),
-    grady(xsize, ysize, 0.0),
-    modgrad(xsize, ysize, 0.0),
-    offset(xsize, ysize, -1000.0);
-    ImageGray<BYTE> canny(xsize, ysize, 0);
+/*----------------------------------------------------------------------------*/
+/** Gradient, non-maxima suppression and sub-pixel position on the columns
+    [x0,x1) of 'image', fused in one pass.
 
-    /* Gaussian filter */
-    gaussian_filter(image, sigma);
-    /* compute gradient */
-    for (x = 1; x < (xsize-1); x++)
-        for (y = 1; y < (ysize-1); y++) {
-            gradx.pixel(x, y) = 0.5*(image.pixel(x+1, y)-image.pixel(x-1, y));
-            grady.pixel(x, y) = 0.5*(image.pixel(x, y+1)-image.pixel(x, y-1));
-            modgrad.pixel(x, y) = sqrt(gradx.pixel(x, y)*gradx.pixel(x, y)
-                                       +grady.pixel(x, y)*grady.pixel(x, y));
+    The gradient is only kept for the strip and its two neighbor columns.
+    Local maxima with a gradient of at least 'th_low' (or above 'th_hi')
+    are appended to 'out', column by column as in a full image sweep.
+ */
+static void devernay_strip(const ImageGray<double> *image, int x0, int x1, double th_low,
+                           double th_hi, std::vector<edge_candidate> *out)
+{
+    int xsize = image->xsize(), ysize = image->ysize();
+    int w = x1 - x0 + 2; /* strip with one column on each side */
+    /* gradient of the strip, stored column by column; single precision is
+       enough for the gradient, the sub-pixel offset is computed in double */
+    std::vector<float> gradx((size_t)w*ysize, 0.0f), grady((size_t)w*ysize, 0.0f),
+    modgrad((size_t)w*ysize, 0.0f);
+    for (int y = 1; y < ysize-1; y++)
+        for (int i = 0, x = x0-1; i < w; i++, x++) {
+            if (x < 1 || x >= xsize-1) continue;
+            double gx = 0.5*(image->pixel(x+1, y)-image->pixel(x-1, y));
+            double gy = 0.5*(image->pixel(x, y+1)-image->pixel(x, y-1));
+            gradx[(size_t)i*ysize+y] = (float)gx;
+            grady[(size_t)i*ysize+y] = (float)gy;
+            modgrad[(size_t)i*ysize+y] = (float)sqrt(gx*gx+gy*gy);
         }
+#define MODGRAD(x, y) modgrad[(size_t)((x)-x0+1)*ysize+(y)]
 
     /* select local maxima */
-    for (x = 2; x < (xsize-2); x++)
-        for (y = 2; y < (ysize-2); y++) {
-            dx = gradx.pixel(x, y);
-            dy = grady.pixel(x, y);
-            i_up = dx > 0.0 ? 1 : -1;
-            i_down = dx > 0.0 ? -1 : 1;
-            j_up = dy > 0.0 ? 1 : -1;
-            j_down = dy > 0.0 ? -1 : 1;
+    for (int x = x0; x < x1; x++)
+        for (int y = 2; y < ysize-2; y++) {
+            double dx = gradx[(size_t)(x-x0+1)*ysize+y];
+            double dy = grady[(size_t)(x-x0+1)*ysize+y];
+            int i_up = dx > 0.0 ? 1 : -1;
+            int i_down = dx > 0.0 ? -1 : 1;
+            int j_up = dy > 0.0 ? 1 : -1;
+            int j_down = dy > 0.0 ? -1 : 1;
+            double weight, mod_up_grad, mod_down_grad;
 
             /* compute grandient values in gradient direction */
-            mod = modgrad.pixel(x, y);
+            double mod = MODGRAD(x, y);
             if (fabs(dx) > fabs(dy)) {/* roughly vertical edge */
                 weight = fabs(dy) / fabs(dx);
                 mod_up_grad
-                    = weight
-                      * modgrad.pixel(x+i_up, y)+(1.0-weight)*modgrad.pixel(x+i_up, y+j_up);
+                    = weight * MODGRAD(x+i_up, y)+(1.0-weight)*MODGRAD(x+i_up, y+j_up);
                 mod_down_grad
-                    = weight* modgrad.pixel(x + i_down, y)
-                      + (1.0-weight) * modgrad.pixel(x + i_down, y+j_down);
+                    = weight* MODGRAD(x + i_down, y)
+                      + (1.0-weight) * MODGRAD(x + i_down, y+j_down);
             } else {/* roughly horizontal edge */
                 weight = fabs(dx) / fabs(dy);
                 mod_up_grad
-                    = weight    * modgrad.pixel(x, y+j_up)
-                      + (1.0-weight) * modgrad.pixel(x +  i_up, y+j_up);
+                    = weight    * MODGRAD(x, y+j_up)
+                      + (1.0-weight) * MODGRAD(x +  i_up, y+j_up);
                 mod_down_grad
-                    = weight    * modgrad.pixel(x, y+j_down)
-                      + (1.0-weight) * modgrad.pixel(x + i_down, y+j_down);
+                    = weight    * MODGRAD(x, y+j_down)
+                      + (1.0-weight) * MODGRAD(x + i_down, y+j_down);
             }
 
-            /* keep local maxima of gradient along gradient direction */
-            if (mod > mod_down_grad && mod >= mod_up_grad) {
-                /* offset value in [-0.5,0.5] also means local maxima */
-                offset.pixel(x, y) = (mod_up_grad - mod_down_grad)
-                                     / (mod + mod - mod_up_grad - mod_down_grad)
-                                     / 2.0;
-                /* Hi Canny threshold on gradient */
-                if (mod > th_hi) { /* a Canny point found */
-                    canny.pixel(x, y) = 255;
-                    add_2tuple(out, (double)x, (double)y);
+            /* keep local maxima of gradient along gradient direction,
+               only the ones that can become Canny points */
+            if (mod > mod_down_grad && mod >= mod_up_grad && (mod >= th_low || mod > th_hi)) {
+                /* offset value in [-0.5,0.5] */
+                double off = (mod_up_grad - mod_down_grad)
+                             / (mod + mod - mod_up_grad - mod_down_grad)
+                             / 2.0;
+                /* normalize gradient */
+                double Dx, Dy;
+                if (fabs(dx) < fabs(dy)) {
+                    Dx = dx/fabs(dy);
+                    Dy = (dy >= 0.0) ? 1.0 : -1.0;
+                } else {
+                    Dx = (dx >= 0.0) ? 1.0 : -1.0;
+                    Dy = dy/fabs(dx);
                 }
+                edge_candidate c;
+                c.pos = (unsigned int)x*ysize+y;
+                c.hi = mod > th_hi;
+                /* apply sub-pixel correcting term */
+                c.x = (double)x + off * Dx;
+                c.y = (double)y + off * Dy;
+                out->push_back(c);
             }
         }
+#undef MODGRAD
+}
+
+/*----------------------------------------------------------------------------*/
+static bool candidate_before(const edge_candidate &c, unsigned int pos)
+{
+    return c.pos < pos;
+}
+
+/*----------------------------------------------------------------------------*/
+/** Devernay sub-pixel edge detector on an already smoothed image.
+
+    Gradient, non-maxima suppression and sub-pixel refinement are done by
+    strips of columns on the thread pool, only the hysteresis is global.
+    The edge points come out in the same order as a column by column sweep.
+ */
+ntuple_list devernay_smoothed(const ImageGray<double> &image, double th_low, double th_hi)
+{
+    ntuple_list out = new_ntuple_list(2);
+    unsigned int x, y, xx, yy, xsize, ysize, i;
+
+    xsize = image.xsize();
+    ysize = image.ysize();
+
+    /* gradient, local maxima and sub-pixel position by strips of columns */
+    const int strip = 64;
+    std::vector<std::vector<edge_candidate> > strips;
+    for (int x0 = 2; x0 < (int)xsize-2; x0 += strip)
+        strips.push_back(std::vector<edge_candidate>());
+    std::vector<concurrent::Future<void>*> ftrs;
+    for (int s = 0, x0 = 2; x0 < (int)xsize-2; s++, x0 += strip)
+        ftrs.push_back(concurrent::asyncInvoke(DEFAULT_THREAD_POOL, &devernay_strip,
+                                               (const ImageGray<double> *)&image, x0,
+                                               std::min(x0+strip, (int)xsize-2), th_low, th_hi,
+                                               &strips[s]));
+    bool allOk;
+    concurrent::getFtr_CheckExcpt(allOk, ftrs);
+    std::for_each(ftrs.begin(), ftrs.end(), [](concurrent::Future<void>* ftr){ delete ftr; });
+    if (!allOk) {
+        free_ntuple_list(out);
+        libMsg::error("devernay: an edge detection task failed.");
+    }
+    std::vector<edge_candidate> candidates;
+    for (int s = 0; s < strips.size(); s++) {
+        candidates.insert(candidates.end(), strips[s].begin(), strips[s].end());
+        std::vector<edge_candidate>().swap(strips[s]);
+    }
+
+    /* 0: no candidate, 1: local maxima with enough gradient, 255: Canny point */
+    ImageGray<BYTE> canny(xsize, ysize, 0);
+    for (i = 0; i < candidates.size(); i++) {
+        x = candidates[i].pos / ysize;
+        y = candidates[i].pos % ysize;
+        if (candidates[i].hi) { /* a Canny point found */
+            canny.pixel(x, y) = 255;
+            add_2tuple(out, (double)x, (double)y);
+        } else {
+            canny.pixel(x, y) = 1;
+        }
+    }
 
     /* Canny hysteresis, second threshold: Low threshold:
        local maxima are accepted as Canny points if,
@@ -149,37 +231,39 @@ ntuple_list devernay(ImageGray<double> &image, double sigma, double th_low, doub
         /* check all 8-connected neightbors */
         for (xx = x-1; xx <= x+1; xx++)
             for (yy = y-1; yy <= y+1; yy++)
-                if (canny.pixel(xx, yy) == 0   /* not marked as Canny P. */
-                    && offset.pixel(xx, yy) > -1.0 /* local maxima */
-                    && modgrad.pixel(xx, yy) >= th_low) {
+                if (canny.pixel(xx, yy) == 1) {
                     canny.pixel(xx, yy) = 255;
                     add_2tuple(out, (double)xx, (double)yy);
                 }
     }
 
-    /* Devernay Sub-pixel refinement */
+    /* Devernay Sub-pixel position */
     for (i = 0; i < out->size; i++) {
         x = (unsigned int)out->values[ i * out->dim + 0 ];
         y = (unsigned int)out->values[ i * out->dim + 1 ];
-        off = offset.pixel(x,y);
-
-        /* normalize gradient */
-        dx = gradx.pixel(x,y);
-        dy = grady.pixel(x,y);
-        if (fabs(dx) < fabs(dy)) {
-            Dx = dx/fabs(dy);
-            Dy = (dy >= 0.0) ? 1.0 : -1.0;
-        } else {
-            Dx = (dx >= 0.0) ? 1.0 : -1.0;
-            Dy = dy/fabs(dx);
-        }
-
-        /* apply sub-pixel correcting term */
-        out->values[ i * out->dim + 0 ] += off * Dx;
-        out->values[ i * out->dim + 1 ] += off * Dy;
+        const edge_candidate &c = *std::lower_bound(candidates.begin(), candidates.end(),
+                                                    x*ysize+y, &candidate_before);
+        out->values[ i * out->dim + 0 ] = c.x;
+        out->values[ i * out->dim + 1 ] = c.y;
     }
 
     return out;
 }
 
 /*----------------------------------------------------------------------------*/
+/** Devernay sub-pixel edge detector, 'image' is smoothed in place.
+ */
+ntuple_list devernay(ImageGray<double> &image, double sigma, double th_low, double th_hi)
+{
+    /* check input */
+    if (!image.isValid())
+        libMsg::error("devernay: invalid input image.");
+    if (sigma <= 0.0) libMsg::error("devernay: sigma must be positive.");
+
+    /* Gaussian filter */
+    gaussian_filter(image, sigma);
+
+    return devernay_smoothed(image, th_low, th_hi);
+}
+
+/*----------------------------------------------------------------------------*/
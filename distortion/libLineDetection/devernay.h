@@ -39,5 +39,9 @@
 ntuple_list devernay( ImageGray<double>& image, double sigma,
                       double th_low, double th_hi );
 
+/* Same as devernay() on an image already smoothed by the caller */
+ntuple_list devernay_smoothed( const ImageGray<double>& image,
+                               double th_low, double th_hi );
+
 #endif /* !DEVERNAY_HEADER */
 /*----------------------------------------------------------------------------*/
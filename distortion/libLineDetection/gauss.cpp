@@ -35,6 +35,14 @@
 #include "messager.h"
 
 #include "ntuple.h"
+// libConcurrent
+#include "abstractthreadpool.h"
+#include "stlCallable.h"
+#include "qthreadpoolbridge.h"
+static concurrent::AbstractThreadPool& DEFAULT_THREAD_POOL = QThreadpoolBridge::DEFAULT;
+
+#include <vector>
+#include <algorithm>
 
 #ifndef UINT_MAX
 #include <limits>
@@ -75,19 +83,141 @@ void gaussian_kernel(ntuple_list kernel, double sigma, double mean)
 }
 
 /*----------------------------------------------------------------------------*/
-void gaussian_filter(ImageGray<double> &image, double sigma)
+/** Symmetry boundary condition: index of the pixel seen at 'j' on an axis
+    of 'size' pixels.
+ */
+static inline int symmetric_index(int j, int size)
 {
-    unsigned int x, y;
-    int offset, i, j, nx2, ny2, n;
-    ntuple_list kernel;
-    double val, prec;
+    int size2 = 2*size;
+    while (j < 0) j += size2;
+    while (j >= size2) j -= size2;
+    if (j >= size) j = size2-1-j;
+    return j;
+}
 
-    if (sigma <= 0.0) libMsg::error("gaussian_filter: 'sigma; must be positive.");
-    if (!image.isValid())
-        libMsg::error("gaussian_filter: invalid image.");
+/*----------------------------------------------------------------------------*/
+/** x axis convolution of rows [y0,y1) of 'in' into 'out'.
+
+    Each row is copied into a buffer padded by 'offset' pixels on both
+    sides, so that the inner loop has no boundary test.
+ */
+static void gaussian_rows_x(const ImageGray<double> *in, ImageGray<double> *out,
+                            const double *kernel, int n, int offset, int y0, int y1)
+{
+    int xsize = in->xsize();
+    std::vector<double> row(xsize + 2*offset);
+    for (int y = y0; y < y1; y++) {
+        const double *src = &in->data(y*xsize);
+        for (int x = -offset; x < xsize+offset; x++)
+            row[x+offset] = src[symmetric_index(x, xsize)];
+        double *dst = &out->data(y*xsize);
+        for (int x = 0; x < xsize; x++) {
+            const double *p = &row[x];
+            double val = 0.0;
+            for (int i = 0; i < n; i++)
+                val += p[i] * kernel[i];
+            dst[x] = val;
+        }
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+/** y axis convolution of rows [y0,y1) of 'in' into 'out'.
+
+    The output row is accumulated from whole input rows, so the inner
+    loop is contiguous and vectorized by the compiler. The additions are
+    done in the same order as a per-pixel convolution.
+ */
+static void gaussian_rows_y(const ImageGray<double> *in, ImageGray<double> *out,
+                            const double *kernel, int n, int offset, int y0, int y1)
+{
+    int xsize = in->xsize(), ysize = in->ysize();
+    for (int y = y0; y < y1; y++) {
+        double *dst = &out->data(y*xsize);
+        std::fill(dst, dst+xsize, 0.0);
+        for (int i = 0; i < n; i++) {
+            const double *src = &in->data(symmetric_index(y-offset+i, ysize)*xsize);
+            const double k = kernel[i];
+            for (int x = 0; x < xsize; x++)
+                dst[x] += src[x] * k;
+        }
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+/** Run 'pass' on strips of rows of 'in' over the thread pool.
+ */
+static void gaussian_pass(void (*pass)(const ImageGray<double> *, ImageGray<double> *,
+                                       const double *, int, int, int, int),
+                          const ImageGray<double> &in, ImageGray<double> &out,
+                          ntuple_list kernel, int offset)
+{
+    const int strip = 64;
+    int ysize = in.ysize();
+    std::vector<concurrent::Future<void>*> ftrs;
+    for (int y = 0; y < ysize; y += strip)
+        ftrs.push_back(concurrent::asyncInvoke(DEFAULT_THREAD_POOL, pass, &in, &out,
+                                               (const double *)kernel->values,
+                                               (int)kernel->dim, offset, y,
+                                               std::min(y+strip, ysize)));
+    bool allOk;
+    concurrent::getFtr_CheckExcpt(allOk, ftrs);
+    std::for_each(ftrs.begin(), ftrs.end(), [](concurrent::Future<void>* ftr){ delete ftr; });
+    if (!allOk)
+        libMsg::error("gaussian_filter: a convolution task failed.");
+}
+
+/*----------------------------------------------------------------------------*/
+/** Smoothing of rows [y0,y1) of the 8-bit image 'in' into 'out'.
+
+    Only the x axis convolution of the rows needed by the strip is kept,
+    so that no full size intermediate image is needed. The arithmetic is
+    the one of gaussian_rows_x() followed by gaussian_rows_y() on the
+    image converted to double.
+ */
+static void gaussian_rows_byte(const ImageGray<BYTE> *in, ImageGray<double> *out,
+                               const double *kernel, int n, int offset, int y0, int y1)
+{
+    int xsize = in->xsize(), ysize = in->ysize();
+    int h = y1 - y0 + 2*offset;
+    std::vector<double> row(xsize + 2*offset);
+    /* row r is the x axis convolution of the row y0-offset+r of 'in' */
+    std::vector<double> xconv((size_t)h*xsize);
+    for (int r = 0; r < h; r++) {
+        const BYTE *src = &in->data(symmetric_index(y0-offset+r, ysize)*xsize);
+        for (int x = -offset; x < xsize+offset; x++)
+            row[x+offset] = (double)src[symmetric_index(x, xsize)];
+        double *dst = &xconv[(size_t)r*xsize];
+        for (int x = 0; x < xsize; x++) {
+            const double *p = &row[x];
+            double val = 0.0;
+            for (int i = 0; i < n; i++)
+                val += p[i] * kernel[i];
+            dst[x] = val;
+        }
+    }
+    for (int y = y0; y < y1; y++) {
+        double *dst = &out->data(y*xsize);
+        std::fill(dst, dst+xsize, 0.0);
+        for (int i = 0; i < n; i++) {
+            const double *src = &xconv[(size_t)(y-y0+i)*xsize];
+            const double k = kernel[i];
+            for (int x = 0; x < xsize; x++)
+                dst[x] += src[x] * k;
+        }
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+/** Gaussian kernel of standard deviation 'sigma' for gaussian_filter(),
+    'offset' receives the position of its center.
+ */
+static ntuple_list filter_kernel(double sigma, int &offset)
+{
+    int n;
+    ntuple_list kernel;
+    double prec;
 
-    /* create temporary image */
-    ImageGray<double> tmp(image.xsize(), image.ysize());
     /* compute gaussian kernel */
     /*
        The size of the kernel is selected to guarantee that the
@@ -102,45 +232,68 @@ void gaussian_filter(ImageGray<double> &image, double sigma)
     n = 1 + 2 * offset; /* kernel size */
     kernel = new_ntuple_list(n);
     gaussian_kernel(kernel, sigma, (double)offset);
-    /* auxiliary double image size variables */
-    nx2 = 2*image.xsize();
-    ny2 = 2*image.ysize();
-    /* x axis convolution */
-    for (x = 0; x < image.xsize(); x++)
-        for (y = 0; y < image.ysize(); y++) {
-            val = 0.0;
-            for (i = 0; i < n; i++) {
-                j = x - offset + i;
-
-                /* symmetry boundary condition */
-                while (j < 0) j += nx2;
-                while (j >= nx2) j -= nx2;
-                if (j >= (int)image.xsize()) j = nx2-1-j;
+    return kernel;
+}
 
-                val += image.pixel(j, y) * kernel->values[i];
-            }
-            tmp.pixel(x, y) = val;
-        }
-    /* y axis convolution */
-    for (x = 0; x < image.xsize(); x++)
-        for (y = 0; y < image.ysize(); y++) {
-            val = 0.0;
-            for (i = 0; i < n; i++) {
-                j = y - offset + i;
+/*----------------------------------------------------------------------------*/
+void gaussian_filter(ImageGray<double> &image, double sigma)
+{
+    int offset;
+    ntuple_list kernel;
 
-                /* symmetry boundary condition */
-                while (j < 0) j += ny2;
-                while (j >= ny2) j -= ny2;
-                if (j >= (int)image.ysize()) j = ny2-1-j;
+    if (sigma <= 0.0) libMsg::error("gaussian_filter: 'sigma; must be positive.");
+    if (!image.isValid())
+        libMsg::error("gaussian_filter: invalid image.");
 
-                val += tmp.pixel(x, j) * kernel->values[i];
-            }
-            image.pixel(x, y) = val;
-        }
+    /* create temporary image */
+    ImageGray<double> tmp(image.xsize(), image.ysize());
+    kernel = filter_kernel(sigma, offset);
+    /* x axis convolution, then y axis convolution, by strips of rows */
+    try {
+        gaussian_pass(&gaussian_rows_x, image, tmp, kernel, offset);
+        gaussian_pass(&gaussian_rows_y, tmp, image, kernel, offset);
+    } catch (...) {
+        free_ntuple_list(kernel);
+        throw;
+    }
     /* free memory */
     free_ntuple_list(kernel);
 }
 
+/*----------------------------------------------------------------------------*/
+/** Gaussian filter of the 8-bit image 'in' into 'out'.
+
+    Gives the same result as gaussian_filter() on 'in' converted to
+    double, without the converted image nor the full size temporary one.
+ */
+void gaussian_filter(const ImageGray<BYTE> &in, double sigma, ImageGray<double> &out)
+{
+    int offset;
+    ntuple_list kernel;
+
+    if (sigma <= 0.0) libMsg::error("gaussian_filter: 'sigma; must be positive.");
+    if (!in.isValid())
+        libMsg::error("gaussian_filter: invalid image.");
+
+    out.resize(in.xsize(), in.ysize());
+    kernel = filter_kernel(sigma, offset);
+    /* both convolutions by strips of rows */
+    const int strip = 64;
+    int ysize = in.ysize();
+    std::vector<concurrent::Future<void>*> ftrs;
+    for (int y = 0; y < ysize; y += strip)
+        ftrs.push_back(concurrent::asyncInvoke(DEFAULT_THREAD_POOL, &gaussian_rows_byte, &in,
+                                               &out, (const double *)kernel->values,
+                                               (int)kernel->dim, offset, y,
+                                               std::min(y+strip, ysize)));
+    bool allOk;
+    concurrent::getFtr_CheckExcpt(allOk, ftrs);
+    std::for_each(ftrs.begin(), ftrs.end(), [](concurrent::Future<void>* ftr){ delete ftr; });
+    free_ntuple_list(kernel);
+    if (!allOk)
+        libMsg::error("gaussian_filter: a convolution task failed.");
+}
+
 /*----------------------------------------------------------------------------*/
 /** Scale the input image 'in' by a factor 'scale' by Gaussian sub-sampling.
 
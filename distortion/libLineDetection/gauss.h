@@ -35,6 +35,7 @@
 
 void gaussian_kernel(ntuple_list kernel, double sigma, double mean);
 void gaussian_filter(ImageGray<double> &image, double sigma);
+void gaussian_filter(const ImageGray<BYTE> &in, double sigma, ImageGray<double> &out);
 void gaussian_sampler(const ImageGray<double>& in, double scale, double sigma_scale, ImageGray<double> &out);
 
 #endif /* !GAUSS_HEADER */
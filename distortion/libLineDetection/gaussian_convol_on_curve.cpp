@@ -3,6 +3,16 @@
 #include "messager.h"
 #include "ntuple.h"
 #include "ntuple_ll.h"
+// libConcurrent
+#include "abstractthreadpool.h"
+#include "stlCallable.h"
+//#include "simplethreadpool.h"
+//static concurrent::AbstractThreadPool& DEFAULT_THREAD_POOL = concurrent::SimpleThreadPool::DEFAULT;
+#include "qthreadpoolbridge.h"
+static concurrent::AbstractThreadPool& DEFAULT_THREAD_POOL = QThreadpoolBridge::DEFAULT;
+
+#include <vector>
+#include <algorithm>
 
 /*----------------------------------------------------------------------------*/
 /** Add a 2-tuple to an 2-tuple list.
@@ -29,93 +39,71 @@ static void add_2tuple( ntuple_list out, double v1, double v2 )
   out->size++;
 }
 
-/*----------------------------------------------------------------------------*/
-/** Add a 1-tuple to an 1-tuple list.
- */
-static void add_1tuple( ntuple_list out, double v1)
-{
-  /* check parameters */
-  if( out == NULL ) libMsg::error("add_1tuple: invalid n-tuple input.");
-  if( out->dim != 1 ) libMsg::error("add_1tuple: the n-tuple must be a 1-tuple.");
-
-  /* if needed, alloc more tuples to 'out' */
-  if( out->size == out->max_size ) enlarge_ntuple_list(out);
-  if( out->values == NULL ) libMsg::error("add_2tuple: invalid n-tuple input.");
-
-  /* add new 2-tuple */
-  out->values[ out->size * out->dim] = v1;
-
-  /* update number of tuples counter */
-  out->size++;
-}
-
-/*----------------------------------------------------------------------------*/
-/** Copy ntuple_list
+/*--------------------------------------------------------------------------*/
+/** Work buffers of convol_one_curve(), reused from one curve to the next.
  */
-static void copy_ntuple(ntuple_list src, ntuple_list des)
+struct curve_buffers
 {
-  /* check parameters */
-  if( src == NULL ) libMsg::error("copy_ntuple: invalid n-tuple input.");
-  if( des == NULL ) libMsg::error("copy_ntuple: invalid n-tuple input.");
-  if( src->dim != des->dim ) libMsg::error("copy_ntuple: different dimension of input.");
-
-  int i, j, nb, dim;
-  nb = src->size;
-  dim = src->dim;
-  
-  des->size = 0;
-
-  for(i = 0; i < nb; i++) {
-    if(des->size == des->max_size) 
-      enlarge_ntuple_list(des);
-    for(j = 0; j < dim; j++)       
-      des->values[i*dim+j] = src->values[i*dim+j];
-    des->size++;
-  }
-}
-
+  std::vector<double> seg_length; /* length of each segment */
+  std::vector<double> upsampled;  /* regularly sampled points, 2 values per point */
+  std::vector<double> weight;     /* Gaussian kernel */
+};
 
 /*--------------------------------------------------------------------------*/
-ntuple_list gaussian_convol_on_curve(double unit_sigma, double Nsigma, bool resampling, bool eliminate_border, double up_factor, double down_factor, ntuple_list orig_edges)
+/** Smoothed and sub-sampled points of one curve, see gaussian_convol_on_curve().
+    The resampled curve and the Gaussian kernel are kept in 'buf', and the
+    convolution is only computed at the points that are kept by the
+    sub-sampling.
+ */
+static ntuple_list convol_one_curve(double unit_sigma, double Nsigma, bool resampling, bool eliminate_border, double up_factor, double down_factor, ntuple_list orig_edges,
+                                    struct curve_buffers &buf)
 {
-  double x1, y1, x2, y2, sumx, sumy, d, norm, w;
+  double x1, y1, x2, y2, sumx, sumy, d, norm;
   int j, k;
-  
+
   double line_length, sample_step = 0.0;
-  ntuple_list upsampled_edges, convolved_upsampled_edges, each_seg_length, output_pts;
-  each_seg_length = new_ntuple_list(1);
+  ntuple_list output_pts;
 
   double residual_d = 0.0, lambda;
   int low_bound, high_bound;
   int size_lambda, begin_lambda;
   double small_seg_x, small_seg_y;
   double sigma;
-  int flag, nb_sigma, not_border_flag;
+  int flag, nb_sigma;
   double real_down_factor;
-  unsigned int nb_pts;
+  unsigned int nb_pts, dim;
+  int nb_up, first_conv, nb_conv;
 
   nb_pts = orig_edges->size;
+  dim = orig_edges->dim;
+  output_pts = new_ntuple_list(2);
+  if (nb_pts < 2) /* no sampling step */
+    return output_pts;
 
-  upsampled_edges = new_ntuple_list(2);
+  /* length of each segment */
+  buf.seg_length.resize(nb_pts);
+  double *each_seg_length = buf.seg_length.data();
 
   /*length of the whole line*/
   line_length = 0.0;
 
   /*the total length of the line and the lenth of each segment*/
   for(j = 0; j < (int)nb_pts-1; j++) {
-    x1 = orig_edges->values[j*orig_edges->dim + 0];
-    y1 = orig_edges->values[j*orig_edges->dim + 1];
-    x2 = orig_edges->values[(j+1)*orig_edges->dim + 0];
-    y2 = orig_edges->values[(j+1)*orig_edges->dim + 1];
+    x1 = orig_edges->values[j*dim + 0];
+    y1 = orig_edges->values[j*dim + 1];
+    x2 = orig_edges->values[(j+1)*dim + 0];
+    y2 = orig_edges->values[(j+1)*dim + 1];
     d=dist(x1,y1,x2,y2);
-    
-    add_1tuple(each_seg_length, d);
+
+    each_seg_length[j] = d;
     line_length += d;
   }
 
   /*the average distance between two points for a line (original line)*/
   sample_step = line_length / (nb_pts-1);
 
+  /* regularly sampled points, 2 values per point */
+  double *upsampled_edges;
 
   if (resampling) {
     /*TANG: the edge points are not regularly sampled, so first do an interpolation to get regularly sampled points*/
@@ -125,134 +113,156 @@ ntuple_list gaussian_convol_on_curve(double unit_sigma, double Nsigma, bool resa
     /*the line is upsampled, the average distance becomes smaller*/
     sample_step /= up_factor;
 
+    /* each segment gets at most 2 more points than its share of the length,
+       the residual distance being below 'sample_step' */
+    buf.upsampled.resize(2*((size_t)(line_length/sample_step) + 2*(size_t)nb_pts + 2));
+    upsampled_edges = buf.upsampled.data();
+    nb_up = 0;
+
     /* Resampling */
     for(j = 0; j < (int)nb_pts-1; j++) {
       flag = 0;
 
-      x1 = orig_edges->values[j*orig_edges->dim + 0];
-      y1 = orig_edges->values[j*orig_edges->dim + 1];
-      x2 = orig_edges->values[(j+1)*orig_edges->dim + 0];
-      y2 = orig_edges->values[(j+1)*orig_edges->dim + 1];
+      x1 = orig_edges->values[j*dim + 0];
+      y1 = orig_edges->values[j*dim + 1];
+      x2 = orig_edges->values[(j+1)*dim + 0];
+      y2 = orig_edges->values[(j+1)*dim + 1];
 
       if (j == 0)
 	residual_d = 0.0;
 
-      size_lambda = (int)floor((each_seg_length->values[j]+residual_d)/sample_step);
-      
+      size_lambda = (int)floor((each_seg_length[j]+residual_d)/sample_step);
+
       begin_lambda = 0;
       if (j != 0)
 	begin_lambda = 1;
 
       for(k = begin_lambda; k <= size_lambda; k++) {
-	lambda = (-residual_d + k*sample_step) / each_seg_length->values[j];
+	lambda = (-residual_d + k*sample_step) / each_seg_length[j];
 	small_seg_x = (1-lambda)*x1 + lambda*x2;
 	small_seg_y = (1-lambda)*y1 + lambda*y2;
 
-	add_2tuple(upsampled_edges, small_seg_x, small_seg_y);
-	
+	upsampled_edges[2*nb_up + 0] = small_seg_x;
+	upsampled_edges[2*nb_up + 1] = small_seg_y;
+	nb_up++;
+
 	flag = 1;
       }
-      
+
       if(flag == 1)
 	residual_d = dist(x2, y2, small_seg_x, small_seg_y);
       else
-	residual_d += each_seg_length->values[j];
+	residual_d += each_seg_length[j];
     }
 
   }
-  else /* no resampling, copy 'orig_edges' to 'upsampled_edges' */
-    copy_ntuple(orig_edges, upsampled_edges);
-  
+  else { /* no resampling, use 'orig_edges' */
+    buf.upsampled.resize(2*(size_t)nb_pts);
+    upsampled_edges = buf.upsampled.data();
+    for(j = 0; j < (int)nb_pts; j++) {
+      upsampled_edges[2*j + 0] = orig_edges->values[j*dim + 0];
+      upsampled_edges[2*j + 1] = orig_edges->values[j*dim + 1];
+    }
+    nb_up = nb_pts;
+  }
+
+  /* Gaussian kernel, the weight of a point only depends on its offset */
+  sigma = unit_sigma * sqrt(down_factor*down_factor - 1.0);
+  nb_sigma = (int)floor( Nsigma * sigma / sample_step );
+  buf.weight.resize(2*(size_t)nb_sigma+1);
+  double *weight = buf.weight.data() + nb_sigma;
+  for (k = -nb_sigma; k <= nb_sigma; k++) {
+    d = sample_step * k;
+    weight[k] = exp( -d*d / 2.0 / sigma / sigma );
+  }
+
+  /* the convolved points are the ones receiving a complete Gaussian convolution
+     when 'eliminate_border' is set, all the points otherwise */
+  if(eliminate_border) {
+    first_conv = nb_sigma;
+    nb_conv = nb_up - 2*nb_sigma;
+    if (nb_conv < 0)
+      nb_conv = 0;
+  } else {
+    first_conv = 0;
+    nb_conv = nb_up;
+  }
 
-  /* convolution */
-  convolved_upsampled_edges = new_ntuple_list(2);
+  if(resampling)
+    real_down_factor = down_factor * up_factor;
+  else
+    real_down_factor = down_factor;
 
-  for(j=0; j<(int)upsampled_edges->size; j++)
+  /* convolution, only on the points kept by the sub-sampling */
+  int c = 0;
+  while(c < nb_conv)
   {
+    j = first_conv + c;
     norm = 0.0; sumx = 0.0; sumy = 0.0;
 
-    sigma = unit_sigma * sqrt(down_factor*down_factor - 1.0);
-    nb_sigma = (int)floor( Nsigma * sigma / sample_step );
-
     low_bound = j - nb_sigma;
     if(low_bound < 0)
       low_bound = 0;
     high_bound = j + nb_sigma;
-    if(high_bound > (int)upsampled_edges->size-1)
-      high_bound = upsampled_edges->size-1;
-
-    if(eliminate_border) {
-      if(high_bound - low_bound == 2*nb_sigma) 
-	not_border_flag = 1;
-      else
-	not_border_flag = 0;
-    }
-    else
-      not_border_flag = 1;
-
-    if(not_border_flag == 1) {
-      for (k = low_bound; k <= high_bound; k++) {
-	/*x1 = upsampled_edges->list[i]->values[upsampled_edges->list[i]->dim*j];
-	y1 = upsampled_edges->list[i]->values[upsampled_edges->list[i]->dim*j+1];
-	x2 = upsampled_edges->list[i]->values[upsampled_edges->list[i]->dim*k];
-	y2 = upsampled_edges->list[i]->values[upsampled_edges->list[i]->dim*k+1];
-	d = dist(x1, y1, x2, y2);*/
-	x2 = upsampled_edges->values[upsampled_edges->dim*k];
-	y2 = upsampled_edges->values[upsampled_edges->dim*k+1];
-	d = sample_step * (k-j);
-	w = exp( -d*d / 2.0 / sigma / sigma );
-	sumx += w*x2;
-	sumy += w*y2;
-	norm += w;
-      }
-  
-      sumx /= norm;
-      sumy /= norm;
-
-      add_2tuple(convolved_upsampled_edges, sumx, sumy);
+    if(high_bound > nb_up-1)
+      high_bound = nb_up-1;
+
+    for (k = low_bound; k <= high_bound; k++) {
+      x2 = upsampled_edges[2*k];
+      y2 = upsampled_edges[2*k+1];
+      sumx += weight[k-j]*x2;
+      sumy += weight[k-j]*y2;
+      norm += weight[k-j];
     }
-  }
 
-  /* if resampling is enabled */
-  /*
-  output_pts = new_ntuple_list(2);
-  if(resampling)
-  {
-    real_down_factor = (int)(down_factor * up_factor);
-    
-    nb = convolved_upsampled_edges->size / real_down_factor + 1;
-    for(j = 0; j < nb; j++)
-      add_2tuple(output_pts, convolved_upsampled_edges->values[j*real_down_factor*convolved_upsampled_edges->dim], convolved_upsampled_edges->values[j*real_down_factor*convolved_upsampled_edges->dim+1]);
-  }
-  else 
-    copy_ntuple(upsampled_edges, output_pts);
-  */
+    sumx /= norm;
+    sumy /= norm;
 
-  output_pts = new_ntuple_list(2);
-  if(resampling)
-    real_down_factor = down_factor * up_factor;
-  else
-    real_down_factor = down_factor;
-  
-  /*
-  nb = (int)((double)convolved_upsampled_edges->size / real_down_factor);
-  
-  for(j = 0; j < nb; j++)
-    add_2tuple(output_pts, convolved_upsampled_edges->values[(int)(j*real_down_factor*convolved_upsampled_edges->dim)], convolved_upsampled_edges->values[(int)(j*real_down_factor*convolved_upsampled_edges->dim)+1]);
-  */
-
-  j = 0;
-  while(j < (int)convolved_upsampled_edges->size) 
-  { 
-    add_2tuple(output_pts, convolved_upsampled_edges->values[(int)(j*convolved_upsampled_edges->dim)], convolved_upsampled_edges->values[(int)(j*convolved_upsampled_edges->dim)+1]);
-    j = floor(j + real_down_factor);
+    add_2tuple(output_pts, sumx, sumy);
+    c = floor(c + real_down_factor);
   }
 
-  free_ntuple_list(upsampled_edges);
-  free_ntuple_list(convolved_upsampled_edges);
-  free_ntuple_list(each_seg_length);
-
   return output_pts;
 }
 
+/*--------------------------------------------------------------------------*/
+ntuple_list gaussian_convol_on_curve(double unit_sigma, double Nsigma, bool resampling, bool eliminate_border, double up_factor, double down_factor, ntuple_list orig_edges)
+{
+  struct curve_buffers buf;
+  return convol_one_curve(unit_sigma, Nsigma, resampling, eliminate_border, up_factor, down_factor, orig_edges, buf);
+}
+
+/*--------------------------------------------------------------------------*/
+/** The curves first, first+step, first+2*step... of gaussian_convol_on_curves().
+ */
+static void convol_curves(double unit_sigma, double Nsigma, bool resampling, bool eliminate_border, double up_factor, double down_factor, const ntuple_list *orig_edges, int nb_curves, int first, int step, ntuple_list *out)
+{
+  struct curve_buffers buf;
+  for (int i = first; i < nb_curves; i += step)
+    out[i] = convol_one_curve(unit_sigma, Nsigma, resampling, eliminate_border, up_factor, down_factor, orig_edges[i], buf);
+}
 
+/*--------------------------------------------------------------------------*/
+void gaussian_convol_on_curves(double unit_sigma, double Nsigma, bool resampling, bool eliminate_border, double up_factor, double down_factor, const ntuple_list *orig_edges, int nb_curves, ntuple_list *out)
+{
+  /* interleaved batches, the curves of a same image have very different lengths */
+  const int batches = 16;
+  for (int i = 0; i < nb_curves; i++)
+    out[i] = NULL;
+  std::vector<concurrent::Future<void>*> ftrs;
+  for (int b = 0; b < batches && b < nb_curves; b++)
+    ftrs.push_back(concurrent::asyncInvoke(DEFAULT_THREAD_POOL, &convol_curves, unit_sigma,
+                                           Nsigma, resampling, eliminate_border, up_factor,
+                                           down_factor, orig_edges, nb_curves, b, batches, out));
+  bool allOk;
+  concurrent::getFtr_CheckExcpt(allOk, ftrs);
+  std::for_each(ftrs.begin(), ftrs.end(), [](concurrent::Future<void>* ftr){ delete ftr; });
+  if (!allOk) {
+    for (int i = 0; i < nb_curves; i++)
+      if (out[i] != NULL) {
+        free_ntuple_list(out[i]);
+        out[i] = NULL;
+      }
+    libMsg::error("gaussian_convol_on_curves: a convolution task failed.");
+  }
+}
@@ -16,4 +16,11 @@
 
 ntuple_list gaussian_convol_on_curve(double unit_sigma, double Nsigma, bool resampling, bool eliminate_border, double up_factor, double down_factor, ntuple_list orig_edges);
 
+/*----------------------------------------------------------------------------*/
+/** Gaussian Convolution on several curves, in batches on the thread pool
+  orig_edges: the 'nb_curves' input curves, the other parameters are the ones of gaussian_convol_on_curve
+  out: receives the 'nb_curves' convolved curves, in the order of 'orig_edges'
+ */
+void gaussian_convol_on_curves(double unit_sigma, double Nsigma, bool resampling, bool eliminate_border, double up_factor, double down_factor, const ntuple_list *orig_edges, int nb_curves, ntuple_list *out);
+
 #endif
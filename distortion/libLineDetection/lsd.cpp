@@ -78,6 +78,14 @@
 #include "image.h"
 #include "lsd.h"
 #include "misc.h"
+// libConcurrent
+#include "abstractthreadpool.h"
+#include "stlCallable.h"
+#include "qthreadpoolbridge.h"
+static concurrent::AbstractThreadPool& DEFAULT_THREAD_POOL = QThreadpoolBridge::DEFAULT;
+
+#include <vector>
+#include <algorithm>
 
 /** ln(10) */
 #ifndef M_LN10
@@ -230,7 +238,7 @@ static void gaussian_sampler(const ImageGray<double> &in, double scale, double s
         libMsg::error("gaussian_sampler: the output image size exceeds the handled size.");
     N = (unsigned int)floor(in.xsize() * scale);
     M = (unsigned int)floor(in.ysize() * scale);
-    aux.resize(M, in.ysize());
+    aux.resize(N, in.ysize());
     out.resize(N, M);
 
     /* sigma, kernel size and memory for the kernel */
@@ -322,13 +330,91 @@ static void gaussian_sampler(const ImageGray<double> &in, double scale, double s
 /*--------------------------------- Gradient ---------------------------------*/
 /*----------------------------------------------------------------------------*/
 
+/*----------------------------------------------------------------------------*/
+/** Bins of the pixels of one strip of columns, see ll_angle().
+ */
+struct ll_angle_strip
+{
+    unsigned int x0, x1;                 /* columns [x0,x1) */
+    struct coorlist *list;               /* memory for the strip's pixels */
+    std::vector<struct coorlist *> range_l_s, range_l_e; /* start and end of bin lists */
+};
+
+/*----------------------------------------------------------------------------*/
+/** Gradient of the columns [x0,x1) of 'in' and their bins, see ll_angle().
+ */
+static void ll_angle_columns(const ImageGray<double> *in, double threshold,
+                             ImageGray<float> *modgrad, unsigned int n_bins, double max_grad,
+                             ImageGray<float> *out, struct ll_angle_strip *strip)
+{
+    unsigned int n, p, x, y, adr, i;
+    double com1, com2, gx, gy, norm, norm2;
+    int list_count = 0;
+    struct coorlist *list = strip->list;
+    struct coorlist **range_l_s = strip->range_l_s.data();
+    struct coorlist **range_l_e = strip->range_l_e.data();
+
+    /* image size shortcuts */
+    n = in->ysize();
+    p = in->xsize();
+
+    /* compute gradient on the remaining pixels */
+    for (x = strip->x0; x < strip->x1; x++)
+        for (y = 0; y < n-1; y++) {
+            adr = y*p+x;
+
+            /*
+               Norm 2 computation using 2x2 pixel window:
+                 A B
+                 C D
+               and
+                 com1 = D-A,  com2 = B-C.
+               Then
+                 gx = B+D - (A+C)   horizontal difference
+                 gy = C+D - (A+B)   vertical difference
+               com1 and com2 are just to avoid 2 additions.
+             */
+            com1 = in->data(adr+p+1) - in->data(adr);
+            com2 = in->data(adr+1)   - in->data(adr+p);
+
+            gx = com1+com2; /* gradient x component */
+            gy = com1-com2; /* gradient y component */
+            norm2 = gx*gx+gy*gy;
+            norm = sqrt(norm2 / 4.0); /* gradient norm */
+
+            modgrad->data(adr) = (float)norm; /* store gradient norm */
+
+            if (norm <= threshold) { /* norm too small, gradient no defined */
+                out->data(adr) = NOTDEF; /* gradient angle not defined */
+            } else {
+                /* gradient angle computation */
+                out->data(adr) = (float)atan2(gx, -gy);
+
+                /* store the point in the right bin according to its norm */
+                i = (unsigned int)(norm * (double)n_bins / max_grad);
+                if (i >= n_bins) i = n_bins-1;
+                if (range_l_e[i] == NULL) {
+                    range_l_s[i] = range_l_e[i] = list+list_count++;
+                } else {
+                    range_l_e[i]->next = list+list_count;
+                    range_l_e[i] = list+list_count++;
+                }
+                range_l_e[i]->x = (int)x;
+                range_l_e[i]->y = (int)y;
+                range_l_e[i]->next = NULL;
+            }
+        }
+}
+
 /*----------------------------------------------------------------------------*/
 /** Computes the direction of the level line of 'in' at each point.
 
     The result is:
-    - an image_double with the angle at each pixel, or NOTDEF if not defined.
-    - the image_double 'modgrad' (a pointer is passed as argument)
+    - an image of float with the angle at each pixel, or NOTDEF if not defined.
+    - the image of float 'modgrad' (a pointer is passed as argument)
       with the gradient magnitude at each point.
+      (Single precision halves the memory of both images, the angle
+      tolerance and the bins are far coarser than its rounding.)
     - a list of pixels 'list_p' roughly ordered by decreasing
       gradient magnitude. (The order is made by classifying points
       into bins by gradient magnitude. The parameters 'n_bins' and
@@ -340,17 +426,13 @@ static void gaussian_sampler(const ImageGray<double> &in, double scale, double s
       free the memory when it is not used anymore.
  */
 static void ll_angle(const ImageGray<double> &in, double threshold, struct coorlist **list_p,
-                     void **mem_p, ImageGray<double> &modgrad, unsigned int n_bins, double max_grad,
-                     ImageGray<double> &out)
+                     void **mem_p, ImageGray<float> &modgrad, unsigned int n_bins, double max_grad,
+                     ImageGray<float> &out)
 {
-    unsigned int n, p, x, y, adr, i;
-    double com1, com2, gx, gy, norm, norm2;
-    /* the rest of the variables are used for pseudo-ordering
-       the gradient magnitude values */
-    int list_count = 0;
+    unsigned int n, p, x, y, i, s;
     struct coorlist *list;
-    struct coorlist **range_l_s; /* array of pointers to start of bin list */
-    struct coorlist **range_l_e; /* array of pointers to end of bin list */
+    std::vector<struct coorlist *> range_l_s; /* array of pointers to start of bin list */
+    std::vector<struct coorlist *> range_l_e; /* array of pointers to end of bin list */
     struct coorlist *start;
     struct coorlist *end;
 
@@ -377,64 +459,48 @@ static void ll_angle(const ImageGray<double> &in, double threshold, struct coorl
     /* get memory for "ordered" list of pixels */
     list = (struct coorlist *)calloc((size_t)(n*p), sizeof(struct coorlist));
     *mem_p = (void *)list;
-    range_l_s = (struct coorlist **)calloc((size_t)n_bins,
-                                           sizeof(struct coorlist *));
-    range_l_e = (struct coorlist **)calloc((size_t)n_bins,
-                                           sizeof(struct coorlist *));
-    if (list == NULL || range_l_s == NULL || range_l_e == NULL)
+    if (list == NULL)
         libMsg::error("not enough memory.");
-    for (i = 0; i < n_bins; i++) range_l_s[i] = range_l_e[i] = NULL;
 
     /* 'undefined' on the down and right boundaries */
     for (x = 0; x < p; x++) out.data((n-1)*p+x) = NOTDEF;
     for (y = 0; y < n; y++) out.data(p*y+p-1) = NOTDEF;
 
-    /* compute gradient on the remaining pixels */
-    for (x = 0; x < p-1; x++)
-        for (y = 0; y < n-1; y++) {
-            adr = y*p+x;
-
-            /*
-               Norm 2 computation using 2x2 pixel window:
-                 A B
-                 C D
-               and
-                 com1 = D-A,  com2 = B-C.
-               Then
-                 gx = B+D - (A+C)   horizontal difference
-                 gy = C+D - (A+B)   vertical difference
-               com1 and com2 are just to avoid 2 additions.
-             */
-            com1 = in.data(adr+p+1) - in.data(adr);
-            com2 = in.data(adr+1)   - in.data(adr+p);
-
-            gx = com1+com2; /* gradient x component */
-            gy = com1-com2; /* gradient y component */
-            norm2 = gx*gx+gy*gy;
-            norm = sqrt(norm2 / 4.0); /* gradient norm */
-
-            modgrad.data(adr) = norm;      /* store gradient norm */
-
-            if (norm <= threshold) { /* norm too small, gradient no defined */
-                out.data(adr) = NOTDEF; /* gradient angle not defined */
-            } else {
-                /* gradient angle computation */
-                out.data(adr) = atan2(gx, -gy);
+    /* compute gradient and bins by strips of columns,
+       each strip uses its own part of 'list' */
+    const unsigned int strip = 64;
+    std::vector<struct ll_angle_strip> strips((p-1 + strip-1) / strip);
+    std::vector<concurrent::Future<void>*> ftrs;
+    for (s = 0; s < strips.size(); s++) {
+        strips[s].x0 = s*strip;
+        strips[s].x1 = std::min(strips[s].x0+strip, p-1);
+        strips[s].list = list + (size_t)strips[s].x0*n;
+        strips[s].range_l_s.assign(n_bins, NULL);
+        strips[s].range_l_e.assign(n_bins, NULL);
+        ftrs.push_back(concurrent::asyncInvoke(DEFAULT_THREAD_POOL, &ll_angle_columns, &in,
+                                               threshold, &modgrad, n_bins, max_grad, &out,
+                                               &strips[s]));
+    }
+    bool allOk;
+    concurrent::getFtr_CheckExcpt(allOk, ftrs);
+    std::for_each(ftrs.begin(), ftrs.end(), [](concurrent::Future<void>* ftr){ delete ftr; });
+    if (!allOk) {
+        free((void *)list);
+        libMsg::error("ll_angle: a gradient task failed.");
+    }
 
-                /* store the point in the right bin according to its norm */
-                i = (unsigned int)(norm * (double)n_bins / max_grad);
-                if (i >= n_bins) i = n_bins-1;
-                if (range_l_e[i] == NULL) {
-                    range_l_s[i] = range_l_e[i] = list+list_count++;
-                } else {
-                    range_l_e[i]->next = list+list_count;
-                    range_l_e[i] = list+list_count++;
-                }
-                range_l_e[i]->x = (int)x;
-                range_l_e[i]->y = (int)y;
-                range_l_e[i]->next = NULL;
+    /* join the bins of the strips, in column order */
+    range_l_s.assign(n_bins, NULL);
+    range_l_e.assign(n_bins, NULL);
+    for (i = 0; i < n_bins; i++)
+        for (s = 0; s < strips.size(); s++)
+            if (strips[s].range_l_s[i] != NULL) {
+                if (range_l_e[i] == NULL)
+                    range_l_s[i] = strips[s].range_l_s[i];
+                else
+                    range_l_e[i]->next = strips[s].range_l_s[i];
+                range_l_e[i] = strips[s].range_l_e[i];
             }
-        }
 
     /* Make the list of pixels (almost) ordered by norm value.
        It starts by the larger bin, so the list starts by the
@@ -452,16 +518,12 @@ static void ll_angle(const ImageGray<double> &in, double threshold, struct coorl
             }
     }
     *list_p = start;
-
-    /* free memory */
-    free((void *)range_l_s);
-    free((void *)range_l_e);
 }
 
 /*----------------------------------------------------------------------------*/
 /** Is point (x,y) aligned to angle theta, up to precision 'prec'?
  */
-static int isaligned(int x, int y, const ImageGray<double> &angles, double theta, double prec)
+static int isaligned(int x, int y, const ImageGray<float> &angles, double theta, double prec)
 {
     double a;
 
@@ -598,6 +660,16 @@ static double log_gamma_windschitl(double x)
  */
 #define TABSIZE 100000
 
+/*----------------------------------------------------------------------------*/
+/** Table of the inverse values 1/i, for i < TABSIZE.
+ */
+static std::vector<double> inverse_table()
+{
+    std::vector<double> inv(TABSIZE, 0.0);
+    for (int i = 1; i < TABSIZE; i++) inv[i] = 1.0 / (double)i;
+    return inv;
+}
+
 /*----------------------------------------------------------------------------*/
 /** Computes -log10(NFA).
 
@@ -642,7 +714,8 @@ static double log_gamma_windschitl(double x)
  */
 static double nfa(int n, int k, double p, double logNT)
 {
-    static double inv[TABSIZE]; /* table to keep computed inverse values */
+    /* table of inverse values, filled once so that threads can share it */
+    static const std::vector<double> inv = inverse_table();
     double tolerance = 0.1;     /* an libMsg::error of 10% in the result is accepted */
     double log1term, term, bin_term, mult_term, bin_tail, err, p_term;
     int i;
@@ -691,13 +764,10 @@ static double nfa(int n, int k, double p, double logNT)
              term_i / term_i-1 = (n-i+1)/i * p/(1-p)
            and
              term_i = term_i-1 * (n-i+1)/i * p/(1-p).
-           1/i is stored in a table as they are computed,
-           because divisions are expensive.
+           1/i is read from a table, because divisions are expensive.
            p/(1-p) is computed only once and stored in 'p_term'.
          */
-        bin_term = (double)(n-i+1) * (i < TABSIZE
-                                      ? (inv[i] != 0.0 ? inv[i] : (inv[i] = 1.0 / (double)i))
-                                      : 1.0 / (double)i);
+        bin_term = (double)(n-i+1) * (i < TABSIZE ? inv[i] : 1.0 / (double)i);
 
         mult_term = bin_term * p_term;
         term *= mult_term;
@@ -1043,7 +1113,7 @@ static rect_iter *ri_ini(struct rect *r)
 /*----------------------------------------------------------------------------*/
 /** Compute a rectangle's NFA value.
  */
-static double rect_nfa(struct rect *rec, const ImageGray<double> &angles, double logNT)
+static double rect_nfa(struct rect *rec, const ImageGray<float> &angles, double logNT)
 {
     rect_iter *i;
     int pts = 0;
@@ -1128,7 +1198,7 @@ static double rect_nfa(struct rect *rec, const ImageGray<double> &angles, double
     get better numeric precision).
  */
 static double get_theta(struct point *reg, int reg_size, double x, double y,
-                        const ImageGray<double> &modgrad, double reg_angle, double prec)
+                        const ImageGray<float> &modgrad, double reg_angle, double prec)
 {
     double lambda, theta, weight;
     double Ixx = 0.0;
@@ -1169,7 +1239,7 @@ static double get_theta(struct point *reg, int reg_size, double x, double y,
 /*----------------------------------------------------------------------------*/
 /** Computes a rectangle that covers a region of points.
  */
-static void region2rect(struct point *reg, int reg_size, const ImageGray<double> &modgrad,
+static void region2rect(struct point *reg, int reg_size, const ImageGray<float> &modgrad,
                         double reg_angle, double prec, double p, struct rect *rec)
 {
     double x, y, dx, dy, l, w, theta, weight, sum, l_min, l_max, w_min, w_max;
@@ -1259,7 +1329,7 @@ static void region2rect(struct point *reg, int reg_size, const ImageGray<double>
 /** Build a region of pixels that share the same angle, up to a
     tolerance 'prec', starting at point (x,y).
  */
-static void region_grow(int x, int y, const ImageGray<double> &angles, struct point *reg,
+static void region_grow(int x, int y, const ImageGray<float> &angles, struct point *reg,
                         int *reg_size, double *reg_angle, ImageGray<BYTE> &used, double prec)
 {
     double sumdx, sumdy;
@@ -1309,7 +1379,7 @@ static void region_grow(int x, int y, const ImageGray<double> &angles, struct po
 /** Try some rectangles variations to improve NFA value. Only if the
     rectangle is not meaningful (i.e., log_nfa <= eps).
  */
-static double rect_improve(struct rect *rec, const ImageGray<double> &angles, double logNT,
+static double rect_improve(struct rect *rec, const ImageGray<float> &angles, double logNT,
                            double eps)
 {
     struct rect r;
@@ -1409,7 +1479,7 @@ static double rect_improve(struct rect *rec, const ImageGray<double> &angles, do
     starting point, until that leads to rectangle with the right
     density of region points or to discard the region if too small.
  */
-static int reduce_region_radius(struct point *reg, int *reg_size, const ImageGray<double> &modgrad,
+static int reduce_region_radius(struct point *reg, int *reg_size, const ImageGray<float> &modgrad,
                                 double reg_angle, double prec, double p, struct rect *rec,
                                 ImageGray<BYTE> &used, double density_th)
 {
@@ -1482,9 +1552,9 @@ static int reduce_region_radius(struct point *reg, int *reg_size, const ImageGra
     produce a rectangle with the right density of region points,
     'reduce_region_radius' is called to try to satisfy this condition.
  */
-static int refine(struct point *reg, int *reg_size, const ImageGray<double> &modgrad,
+static int refine(struct point *reg, int *reg_size, const ImageGray<float> &modgrad,
                   double reg_angle, double prec, double p, struct rect *rec, ImageGray<BYTE> &used,
-                  const ImageGray<double> &angles, double density_th)
+                  const ImageGray<float> &angles, double density_th)
 {
     double angle, ang_d, mean_angle, tau, density, xc, yc, ang_c, sum, s_sum;
     int i, n;
@@ -1550,6 +1620,26 @@ static int refine(struct point *reg, int *reg_size, const ImageGray<double> &mod
     return TRUE;
 }
 
+/*----------------------------------------------------------------------------*/
+/** Rectangle of a refined region, waiting for its NFA value.
+ */
+struct lsd_candidate
+{
+    struct rect rec;
+    std::vector<struct point> reg; /* points of the region */
+    double log_nfa;
+};
+
+/*----------------------------------------------------------------------------*/
+/** NFA of the candidates first, first+step, first+2*step...
+ */
+static void lsd_candidates_nfa(std::vector<struct lsd_candidate> *candidates, int first, int step,
+                               const ImageGray<float> *angles, double logNT, double eps)
+{
+    for (int c = first; c < (int)candidates->size(); c += step)
+        (*candidates)[c].log_nfa = rect_improve(&(*candidates)[c].rec, *angles, logNT, eps);
+}
+
 /*----------------------------------------------------------------------------*/
 /*-------------------------- Line Segment Detector ---------------------------*/
 /*----------------------------------------------------------------------------*/
@@ -1562,7 +1652,7 @@ ntuple_list LineSegmentDetection(const ImageGray<double> &image, double scale, d
                                  int n_bins, double max_grad, ImageGray<int> *region)
 {
     ntuple_list out = new_ntuple_list(5);
-    ImageGray<double> angles, modgrad;
+    ImageGray<float> angles, modgrad;
     ImageGray<BYTE> used;
     struct coorlist *list_p;
     void *mem_p;
@@ -1570,7 +1660,7 @@ ntuple_list LineSegmentDetection(const ImageGray<double> &image, double scale, d
     struct point *reg;
     int reg_size, min_reg_size, i;
     unsigned int xsize, ysize;
-    double rho, reg_angle, prec, p, log_nfa, logNT;
+    double rho, reg_angle, prec, p, logNT;
     int ls_count = 0;                 /* line segments are numbered 1,2,3,... */
 
     /* check parameters */
@@ -1614,7 +1704,9 @@ ntuple_list LineSegmentDetection(const ImageGray<double> &image, double scale, d
     reg = (struct point *)calloc((size_t)(xsize*ysize), sizeof(struct point));
     if (reg == NULL) libMsg::error("not enough memory!");
 
-    /* search for line segments */
+    /* search for line segments: the regions are grown and refined in order,
+       their NFA, which does not change the used pixels, is computed afterwards */
+    std::vector<struct lsd_candidate> candidates;
     for (; list_p != NULL; list_p = list_p->next)
         if (used.pixel(list_p->x, list_p->y) == NOTUSED
             && angles.pixel(list_p->x, list_p->y) != NOTDEF) {
@@ -1642,44 +1734,64 @@ ntuple_list LineSegmentDetection(const ImageGray<double> &image, double scale, d
             if (!refine(reg, &reg_size, modgrad, reg_angle,
                         prec, p, &rec, used, angles, density_th)) continue;
 
-            /* compute NFA value */
-            log_nfa = rect_improve(&rec, angles, logNT, eps);
-            if (log_nfa <= eps) continue;
+            candidates.push_back(lsd_candidate());
+            candidates.back().rec = rec;
+            candidates.back().reg.assign(reg, reg+reg_size);
+        }
+    free((void *)reg);
+    free((void *)mem_p);
 
-            /* A New Line Segment was found! */
-            ++ls_count; /* increase line segment counter */
+    /* compute NFA values, candidates interleaved to balance the tasks */
+    const int batches = 16;
+    std::vector<concurrent::Future<void>*> ftrs;
+    for (int b = 0; b < batches && b < (int)candidates.size(); b++)
+        ftrs.push_back(concurrent::asyncInvoke(DEFAULT_THREAD_POOL, &lsd_candidates_nfa,
+                                               &candidates, b, batches,
+                                               (const ImageGray<float> *)&angles, logNT, eps));
+    bool allOk;
+    concurrent::getFtr_CheckExcpt(allOk, ftrs);
+    std::for_each(ftrs.begin(), ftrs.end(), [](concurrent::Future<void>* ftr){ delete ftr; });
+    if (!allOk) {
+        free_ntuple_list(out);
+        libMsg::error("LineSegmentDetection: a NFA task failed.");
+    }
 
-            /*
-               The gradient was computed with a 2x2 mask, its value corresponds to
-               points with an offset of (0.5,0.5), that should be added to output.
-               The coordinates origin is at the center of pixel (0,0).
-             */
-            rec.x1 += 0.5;
-            rec.y1 += 0.5;
-            rec.x2 += 0.5;
-            rec.y2 += 0.5;
-
-            /* scale the result values if a subsampling was performed */
-            if (scale != 1.0) {
-                rec.x1 /= scale;
-                rec.y1 /= scale;
-                rec.x2 /= scale;
-                rec.y2 /= scale;
-                rec.width /= scale;
-            }
+    /* keep the meaningful rectangles, in detection order */
+    for (std::vector<struct lsd_candidate>::iterator c = candidates.begin();
+         c != candidates.end(); ++c) {
+        rec = c->rec;
+        if (c->log_nfa <= eps) continue;
 
-            /* add line segment found to output */
-            add_5tuple(out, rec.x1, rec.y1, rec.x2, rec.y2, rec.width);
+        /* A New Line Segment was found! */
+        ++ls_count; /* increase line segment counter */
 
-            /* add region number to 'region' image if needed */
-            if (region != NULL)
-                for (i = 0; i < reg_size; i++)
-                    region->pixel(reg[i].x, reg[i].y) = ls_count;
+        /*
+           The gradient was computed with a 2x2 mask, its value corresponds to
+           points with an offset of (0.5,0.5), that should be added to output.
+           The coordinates origin is at the center of pixel (0,0).
+         */
+        rec.x1 += 0.5;
+        rec.y1 += 0.5;
+        rec.x2 += 0.5;
+        rec.y2 += 0.5;
+
+        /* scale the result values if a subsampling was performed */
+        if (scale != 1.0) {
+            rec.x1 /= scale;
+            rec.y1 /= scale;
+            rec.x2 /= scale;
+            rec.y2 /= scale;
+            rec.width /= scale;
         }
 
-    /* free memory */
-    free((void *)reg);
-    free((void *)mem_p);
+        /* add line segment found to output */
+        add_5tuple(out, rec.x1, rec.y1, rec.x2, rec.y2, rec.width);
+
+        /* add region number to 'region' image if needed */
+        if (region != NULL)
+            for (i = 0; i < (int)c->reg.size(); i++)
+                region->pixel(c->reg[i].x, c->reg[i].y) = ls_count;
+    }
 
     return out;
 }
@@ -31,6 +31,10 @@
 #include "ntuple_ll.h"
 #include "devernay.h"
 #include "lsd.h"
+#include "gauss.h"
+
+#include <vector>
+#include <algorithm>
 
 #ifndef M_PI
 #define M_PI   3.14159265358979323846
@@ -43,86 +47,81 @@ struct point
 };
 
 /*----------------------------------------------------------------------------*/
-static int comp_point_x(const void *a, const void *b)
-{
-    if (((struct point *)a)->x < ((struct point *)b)->x) return -1;
-    /* if( ((struct point *)a)->x == ((struct point *)b)->x ) return  0; */
-    if (((struct point *)a)->x > ((struct point *)b)->x) return 1;
-    return 0; /* so c compiler knows the functions does return a value */
-}
-
-/*----------------------------------------------------------------------------*/
-static int comp_point_y(const void *a, const void *b)
-{
-    if (((struct point *)a)->y < ((struct point *)b)->y) return -1;
-    /* if( ((struct point *)a)->y == ((struct point *)b)->y ) return  0; */
-    if (((struct point *)a)->y > ((struct point *)b)->y) return 1;
-    return 0; /* so c compiler knows the functions does return a value */
-}
-
-static int comp_point_y_decrease(const void *a, const void *b)
+/** Edge point with its sort key.
+ */
+struct keyed_point
 {
-    if (((struct point *)a)->y < ((struct point *)b)->y) return 1;
-    /* if( ((struct point *)a)->y == ((struct point *)b)->y ) return 0; */
-    if (((struct point *)a)->y > ((struct point *)b)->y) return -1;
-    return 0; /* so c compiler knows the functions does return a value */
-}
+    float key;
+    struct point pt;
+};
 
 /*----------------------------------------------------------------------------*/
-static void sort_edge_points(ntuple_ll se, ntuple_list ls)
+/** Sort the 'n' points of line segment 'i' of 'ls' along its main direction:
+    by x if its angle is below PI/4, by increasing y if it goes down,
+    by decreasing y if it goes up.
+
+    The points are counted in buckets of one pixel of their sort key, then
+    each bucket, which holds a few points, is ordered by insertion. This is
+    linear in the number of points plus the length of the segment. Points
+    with equal keys keep their order. 'tmp' is a buffer of 'n' elements,
+    'count' is reused between segments.
+ */
+static void sort_edge_points(struct point *p, unsigned int n, ntuple_list ls, unsigned int i,
+                             struct keyed_point *tmp, std::vector<unsigned int> &count)
 {
-    unsigned int i, j, n;
-    struct point *p;
+    unsigned int j, k, b, range;
+    float kmin, key;
     double theta;
-
-    for (i = 0; i < se->size; i++) {
-        n = se->list[i]->size;
-
-        /* get memory */
-        p = (struct point *)calloc((size_t)n, sizeof(struct point));
-        if (p == NULL) libMsg::error("not enough memory!");
-
-        /* copy points to list */
-        for (j = 0; j < n; j++) {
-            p[j].x = se->list[i]->values[ j*2 + 0 ];
-            p[j].y = se->list[i]->values[ j*2 + 1 ];
-        }
-
-        /* sort */
-        /* if line segment angle < PI/4, sort according to x value,
-           else according to y value. */
-        /*
-        if( fabs(atan( ( ls->values[ i * ls->dim + 3 ]
-                       - ls->values[ i * ls->dim + 1 ] ) /
-                       ( ls->values[ i * ls->dim + 2 ]
-                       - ls->values[ i * ls->dim + 0 ] ) )) < (M_PI / 4.0) )
-          qsort( (void *)p, n, sizeof(struct point), &comp_point_x );
-        else
-          qsort( (void *)p, n, sizeof(struct point), &comp_point_y );
-        */
-
-        theta = atan((ls->values[ i * ls->dim + 3 ]
-                      - ls->values[ i * ls->dim + 1 ])
-                     /(ls->values[ i * ls->dim + 2 ]
-                       - ls->values[ i * ls->dim + 0 ]));
-        if (theta < (M_PI / 4.0) && theta > (-M_PI / 4.0))
-            qsort((void *)p, n, sizeof(struct point), &comp_point_x);
-        else if (theta >= (M_PI / 4.0))
-            qsort((void *)p, n, sizeof(struct point), &comp_point_y);
-        else if (theta <= -(M_PI / 4.0))
-            qsort((void *)p, n, sizeof(struct point), &comp_point_y_decrease);
-        else
-            libMsg::error("[straight_edge_points]: theta libMsg::error!\n");
-
-        /* copy back sorted points */
-        for (j = 0; j < n; j++) {
-            se->list[i]->values[ j*2 + 0 ] = p[j].x;
-            se->list[i]->values[ j*2 + 1 ] = p[j].y;
-        }
-
-        /* free memory */
-        free((void *)p);
+    int axis = 0; /* 0: x, 1: y, 2: -y */
+
+    if (n < 2) return;
+
+    theta = atan((ls->values[ i * ls->dim + 3 ]
+                  - ls->values[ i * ls->dim + 1 ])
+                 /(ls->values[ i * ls->dim + 2 ]
+                   - ls->values[ i * ls->dim + 0 ]));
+    if (theta < (M_PI / 4.0) && theta > (-M_PI / 4.0))
+        axis = 0;
+    else if (theta >= (M_PI / 4.0))
+        axis = 1;
+    else if (theta <= -(M_PI / 4.0))
+        axis = 2;
+    else
+        libMsg::error("[straight_edge_points]: theta libMsg::error!\n");
+#define SORT_KEY(pt) (axis == 0 ? (pt).x : axis == 1 ? (pt).y : -(pt).y)
+
+    kmin = SORT_KEY(p[0]);
+    for (j = 1; j < n; j++)
+        if (SORT_KEY(p[j]) < kmin) kmin = SORT_KEY(p[j]);
+    kmin = floorf(kmin);
+    range = 0;
+    for (j = 0; j < n; j++)
+        if ((unsigned int)(SORT_KEY(p[j]) - kmin) > range)
+            range = (unsigned int)(SORT_KEY(p[j]) - kmin);
+
+    /* stable counting sort on the integer part of the keys */
+    count.assign(range + 2, 0);
+    for (j = 0; j < n; j++)
+        count[(unsigned int)(SORT_KEY(p[j]) - kmin) + 1]++;
+    for (b = 1; b < count.size(); b++)
+        count[b] += count[b-1];
+    for (j = 0; j < n; j++) {
+        key = SORT_KEY(p[j]);
+        struct keyed_point &kp = tmp[count[(unsigned int)(key - kmin)]++];
+        kp.key = key;
+        kp.pt = p[j];
+    }
+#undef SORT_KEY
+
+    /* insertion sort inside the buckets, every point is close to its place */
+    for (j = 1; j < n; j++) {
+        struct keyed_point kp = tmp[j];
+        for (k = j; k > 0 && tmp[k-1].key > kp.key; k--)
+            tmp[k] = tmp[k-1];
+        tmp[k] = kp;
     }
+    for (j = 0; j < n; j++)
+        p[j] = tmp[j].pt;
 }
 
 /*----------------------------------------------------------------------------*/
@@ -153,39 +152,45 @@ static void remove_short_edges(ntuple_ll se, ntuple_list ls, double threshold)
 }
 
 /*----------------------------------------------------------------------------*/
-/** Add a 2-tuple to an 2-tuple list.
+/** New 2-tuple list holding the 'n' points 'p'.
  */
-static void add_2tuple(ntuple_list out, double v1, double v2)
+static ntuple_list new_2tuple_list(const struct point *p, unsigned int n)
 {
-    /* check parameters */
-    if (out == NULL) libMsg::error("add_2tuple: invalid n-tuple input.");
-    if (out->dim != 2) libMsg::error("add_2tuple: the n-tuple must be a 2-tuple.");
+    unsigned int j;
+    ntuple_list out = new_ntuple_list(2);
 
-    /* if needed, alloc more tuples to 'out' */
-    if (out->size == out->max_size) enlarge_ntuple_list(out);
-    if (out->values == NULL) libMsg::error("add_2tuple: invalid n-tuple input.");
-
-    /* add new 2-tuple */
-    out->values[ out->size * out->dim + 0 ] = v1;
-    out->values[ out->size * out->dim + 1 ] = v2;
+    if (n > out->max_size) {
+        out->max_size = n;
+        out->values = (double *)realloc((void *)out->values, 2 * n * sizeof(double));
+        if (out->values == NULL) libMsg::error("not enough memory.");
+    }
+    for (j = 0; j < n; j++) {
+        out->values[ j*2 + 0 ] = p[j].x;
+        out->values[ j*2 + 1 ] = p[j].y;
+    }
+    out->size = n;
 
-    /* update number of tuples counter */
-    out->size++;
+    return out;
 }
 
 /*----------------------------------------------------------------------------*/
-ntuple_ll straight_edge_points(ImageGray<double> &image, double sigma, double th_low, double th_hi,
-                               double min_length)
+/** Straight edges of the already smoothed 'image', see straight_edge_points().
+ */
+static ntuple_ll smoothed_straight_edge_points(const ImageGray<double> &image, double th_low,
+                                               double th_hi, double min_length)
 {
     ntuple_list edges; /* edge points */
     ntuple_list ls;    /* line segments */
     ImageGray<int> region;
     ntuple_ll se;      /* straight edges */
-    unsigned int i, x, y, seg;
+    unsigned int i, x, y, seg, n, max_n;
     double xx, yy;
+    std::vector<unsigned int> edge_seg, first, count;
+    std::vector<struct point> p;
+    std::vector<struct keyed_point> tmp;
 
     /* call Devernay sub-pixel edge detector */
-    edges = devernay(image, sigma, th_low, th_hi);
+    edges = devernay_smoothed(image, th_low, th_hi);
     /* call LSD line segment detector */
     ls = lsd_scale_region(image, 1.0, &region);
 
@@ -193,25 +198,53 @@ ntuple_ll straight_edge_points(ImageGray<double> &image, double sigma, double th
     // Problème : tous les ntuple_list créés par lsd_scale(_region) sont de taille nulle et de taille max égale à 1
 
     se = new_ntuple_ll(ls->size);
-    for (i = 0; i < ls->size; i++)
-        add_ntuple_list(se, new_ntuple_list(2)); /* create all the n-tuple lists */ // <- memory leak
 
-    /* assign edge points to line segments */
+    /* assign edge points to line segments: segment of each point (0 for none),
+       then the points of segment i are stored in p[first[i]..first[i+1]) */
+    edge_seg.resize(edges->size);
+    first.assign(ls->size + 1, 0);
     for (i = 0; i < edges->size; i++) {
         xx = edges->values[ i * edges->dim + 0 ];
         yy = edges->values[ i * edges->dim + 1 ];
         x = xx; /* interger part of the edge coordinates */
         y = yy;
 
+        edge_seg[i] = 0;
         if (x < region.xsize() && y < region.ysize()) { /* unsigned, so x>=0 and y>=0 */
             if ((seg = region.pixel(x, y)) > 0)
-                if ((seg-1) < se->size) /* seg corresponds to line segment seg-1 */
-                    add_2tuple(se->list[seg-1], xx, yy);
+                if ((seg-1) < ls->size) { /* seg corresponds to line segment seg-1 */
+                    edge_seg[i] = seg;
+                    first[seg-1]++;
+                }
         }
     }
+    /* first[i] is the end of segment i, then its start once its points are stored */
+    max_n = 0;
+    for (i = 0; i < ls->size; i++) {
+        if (first[i] > max_n) max_n = first[i];
+        if (i > 0) first[i] += first[i-1];
+    }
+    first[ls->size] = ls->size > 0 ? first[ls->size-1] : 0;
+    p.resize(first[ls->size]);
+    tmp.resize(max_n);
+    /* backwards, so that each segment keeps the order of the edge list */
+    for (i = edges->size; i-- > 0; )
+        if ((seg = edge_seg[i]) > 0) {
+            struct point &pt = p[--first[seg-1]];
+            pt.x = edges->values[ i * edges->dim + 0 ];
+            pt.y = edges->values[ i * edges->dim + 1 ];
+        }
+
+    /* sort edge points in each line segment and create its n-tuple list */
+    for (i = 0; i < ls->size; i++) {
+        n = first[i+1] - first[i];
+        /* short ones are removed below */
+        if (dist(ls->values[i*ls->dim + 0], ls->values[i*ls->dim + 1],
+                 ls->values[i*ls->dim + 2], ls->values[i*ls->dim + 3]) >= min_length)
+            sort_edge_points(p.data() + first[i], n, ls, i, tmp.data(), count);
+        add_ntuple_list(se, new_2tuple_list(p.data() + first[i], n));
+    }
 
-    /* sort edge points in each line segment */
-    sort_edge_points(se, ls);
     /* remove edges correspoinding to short line segments */
     remove_short_edges(se, ls, min_length);
     /* free memory */
@@ -222,3 +255,27 @@ ntuple_ll straight_edge_points(ImageGray<double> &image, double sigma, double th
 }
 
 /*----------------------------------------------------------------------------*/
+ntuple_ll straight_edge_points(ImageGray<double> &image, double sigma, double th_low, double th_hi,
+                               double min_length)
+{
+    if (!image.isValid())
+        libMsg::error("straight_edge_points: invalid input image.");
+    if (sigma <= 0.0) libMsg::error("straight_edge_points: sigma must be positive.");
+    gaussian_filter(image, sigma);
+    return smoothed_straight_edge_points(image, th_low, th_hi, min_length);
+}
+
+/*----------------------------------------------------------------------------*/
+ntuple_ll straight_edge_points(const ImageGray<BYTE> &image, double sigma, double th_low,
+                               double th_hi, double min_length)
+{
+    if (!image.isValid())
+        libMsg::error("straight_edge_points: invalid input image.");
+    if (sigma <= 0.0) libMsg::error("straight_edge_points: sigma must be positive.");
+    /* the smoothing is the first double image */
+    ImageGray<double> smoothed;
+    gaussian_filter(image, sigma, smoothed);
+    return smoothed_straight_edge_points(smoothed, th_low, th_hi, min_length);
+}
+
+/*----------------------------------------------------------------------------*/
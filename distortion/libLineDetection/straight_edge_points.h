@@ -31,5 +31,12 @@ ntuple_ll straight_edge_points(ImageGray<double>& image, double sigma,
                                 double th_low, double th_hi,
                                 double min_length );
 
+/*----------------------------------------------------------------------------*/
+/** Same as above on an 8-bit image, the smoothing reads it directly.
+ */
+ntuple_ll straight_edge_points(const ImageGray<BYTE>& image, double sigma,
+                                double th_low, double th_hi,
+                                double min_length );
+
 #endif /* !STRAIGHT_EDGE_POINTS_HEADER */
 /*----------------------------------------------------------------------------*/
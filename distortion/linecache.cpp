@@ -0,0 +1,193 @@
+#include "linecache.h"
+
+#include "messager.h"
+
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <algorithm>
+#include <cstdio>
+
+using namespace DistortionModule;
+
+static const uint32_t CACHE_MAGIC = 0x31434e4c; // "LNC1"
+static const char *INDEX_NAME = "index.txt";
+
+LineCache &LineCache::instance()
+{
+    static LineCache cache;
+    return cache;
+}
+
+void LineCache::configure(const std::string &dir, size_t maxBytes)
+{
+    std::lock_guard<std::mutex> locker(lock);
+    this->dir = dir;
+    this->maxBytes = maxBytes;
+    entries.clear();
+    if (!enabled())
+        return;
+    readIndex();
+    evict();
+}
+
+/* FNV-1a over the image size, the pixels and the parameters */
+uint64_t LineCache::key(const ImageGray<BYTE> &image, const std::vector<double> &params)
+{
+    uint64_t h = 14695981039346656037ULL;
+    auto feed = [&h](const unsigned char *p, size_t n) {
+        for (size_t i = 0; i < n; ++i) {
+            h ^= p[i];
+            h *= 1099511628211ULL;
+        }
+    };
+    int size[2] = { image.xsize(), image.ysize() };
+    feed(reinterpret_cast<const unsigned char *>(size), sizeof(size));
+    if (image.isValid())
+        feed(&image.data(0), (size_t)size[0]*size[1]);
+    feed(reinterpret_cast<const unsigned char *>(params.data()), params.size()*sizeof(double));
+    return h;
+}
+
+std::string LineCache::entryPath(uint64_t key) const
+{
+    std::ostringstream name;
+    name<<dir<<'/'<<std::hex<<std::setw(16)<<std::setfill('0')<<key<<".lines";
+    return name.str();
+}
+
+bool LineCache::load(uint64_t key, LineSet &lines)
+{
+    std::lock_guard<std::mutex> locker(lock);
+    if (!enabled())
+        return false;
+    auto entry = std::find_if(entries.begin(), entries.end(),
+                              [key](const std::pair<uint64_t, size_t> &e){ return e.first == key; });
+    if (entry == entries.end())
+        return false;
+
+    std::ifstream in(entryPath(key), std::ios::binary | std::ios::ate);
+    /* the counts read from the file are bounded by what is left of it */
+    uint64_t remaining = in ? (uint64_t)in.tellg() : 0;
+    in.seekg(0);
+    uint32_t magic = 0, nLines = 0;
+    uint64_t fileKey = 0;
+    in.read(reinterpret_cast<char *>(&magic), sizeof(magic));
+    in.read(reinterpret_cast<char *>(&fileKey), sizeof(fileKey));
+    in.read(reinterpret_cast<char *>(&nLines), sizeof(nLines));
+    const uint64_t header = sizeof(magic)+sizeof(fileKey)+sizeof(nLines);
+    bool ok = in && magic == CACHE_MAGIC && fileKey == key && remaining >= header;
+    remaining -= ok ? header : remaining;
+    ok = ok && nLines <= remaining/sizeof(uint32_t);
+    LineSet result;
+    if (ok) {
+        result.resize(nLines);
+        for (uint32_t i = 0; i < nLines && ok; ++i) {
+            uint32_t nPoints = 0;
+            if (remaining < sizeof(nPoints)) {
+                ok = false;
+                break;
+            }
+            in.read(reinterpret_cast<char *>(&nPoints), sizeof(nPoints));
+            remaining -= sizeof(nPoints);
+            if (!in || nPoints > remaining/(2*sizeof(double))) {
+                ok = false;
+                break;
+            }
+            remaining -= 2*sizeof(double)*(uint64_t)nPoints;
+            result[i].resize(nPoints);
+            std::vector<double> xy(2*(size_t)nPoints);
+            in.read(reinterpret_cast<char *>(xy.data()), xy.size()*sizeof(double));
+            for (uint32_t j = 0; j < nPoints; ++j)
+                result[i][j] = std::make_pair(xy[2*j], xy[2*j+1]);
+            ok = bool(in);
+        }
+    }
+    if (!ok) {
+        libMsg::cout<<"Corrupted line cache entry dropped: "<<entryPath(key)<<libMsg::endl;
+        std::remove(entryPath(key).c_str());
+        entries.erase(entry);
+        writeIndex();
+        return false;
+    }
+
+    // most recently used goes last
+    std::pair<uint64_t, size_t> used = *entry;
+    entries.erase(entry);
+    entries.push_back(used);
+    writeIndex();
+    lines.swap(result);
+    return true;
+}
+
+void LineCache::store(uint64_t key, const LineSet &lines)
+{
+    std::lock_guard<std::mutex> locker(lock);
+    if (!enabled())
+        return;
+    std::ofstream out(entryPath(key), std::ios::binary | std::ios::trunc);
+    uint32_t nLines = lines.size();
+    out.write(reinterpret_cast<const char *>(&CACHE_MAGIC), sizeof(CACHE_MAGIC));
+    out.write(reinterpret_cast<const char *>(&key), sizeof(key));
+    out.write(reinterpret_cast<const char *>(&nLines), sizeof(nLines));
+    size_t bytes = sizeof(CACHE_MAGIC)+sizeof(key)+sizeof(nLines);
+    for (uint32_t i = 0; i < nLines; ++i) {
+        uint32_t nPoints = lines[i].size();
+        std::vector<double> xy;
+        xy.reserve(2*(size_t)nPoints);
+        for (uint32_t j = 0; j < nPoints; ++j) {
+            xy.push_back(lines[i][j].first);
+            xy.push_back(lines[i][j].second);
+        }
+        out.write(reinterpret_cast<const char *>(&nPoints), sizeof(nPoints));
+        out.write(reinterpret_cast<const char *>(xy.data()), xy.size()*sizeof(double));
+        bytes += sizeof(nPoints)+xy.size()*sizeof(double);
+    }
+    out.close();
+    if (!out) {
+        libMsg::cout<<"Cannot write line cache entry "<<entryPath(key)<<libMsg::endl;
+        std::remove(entryPath(key).c_str());
+        return;
+    }
+
+    entries.erase(std::remove_if(entries.begin(), entries.end(),
+                                 [key](const std::pair<uint64_t, size_t> &e){ return e.first == key; }),
+                  entries.end());
+    entries.push_back(std::make_pair(key, bytes));
+    evict();
+    writeIndex();
+}
+
+void LineCache::readIndex()
+{
+    std::ifstream in(dir+'/'+INDEX_NAME);
+    uint64_t key;
+    size_t bytes;
+    while (in>>std::hex>>key>>std::dec>>bytes)
+        entries.push_back(std::make_pair(key, bytes));
+}
+
+void LineCache::writeIndex() const
+{
+    std::ofstream out(dir+'/'+INDEX_NAME, std::ios::trunc);
+    for (const std::pair<uint64_t, size_t> &e : entries)
+        out<<std::hex<<e.first<<' '<<std::dec<<e.second<<'\n';
+}
+
+/* drop the least recently used entries until the directory fits in maxBytes */
+void LineCache::evict()
+{
+    size_t total = 0;
+    for (const std::pair<uint64_t, size_t> &e : entries)
+        total += e.second;
+    size_t n = 0;
+    while (n < entries.size() && total > maxBytes) {
+        std::remove(entryPath(entries[n].first).c_str());
+        total -= entries[n].second;
+        n++;
+    }
+    if (n > 0) {
+        entries.erase(entries.begin(), entries.begin()+n);
+        writeIndex();
+    }
+}
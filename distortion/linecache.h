@@ -0,0 +1,49 @@
+#ifndef LINECACHE_H
+#define LINECACHE_H
+
+// libImage
+#include "image.h"
+
+#include <string>
+#include <vector>
+#include <utility>
+#include <mutex>
+#include <cstdint>
+
+namespace DistortionModule {
+typedef std::vector<std::vector<std::pair<double, double> > > LineSet;
+
+/**
+ * @brief On-disk cache of the lines detected in one harp image.
+ *
+ * An entry holds the convolved points of every line kept for an image, keyed by
+ * the image content and the detection parameters. The entries are listed in an
+ * index file in least recently used order, the oldest ones are removed when the
+ * directory grows over its size limit. An empty directory disables the cache.
+ */
+class LineCache
+{
+public:
+    static LineCache &instance();
+
+    void configure(const std::string &dir, size_t maxBytes);
+    bool enabled() const { return !dir.empty(); }
+
+    static uint64_t key(const ImageGray<BYTE> &image, const std::vector<double> &params);
+    bool load(uint64_t key, LineSet &lines);
+    void store(uint64_t key, const LineSet &lines);
+
+private:
+    LineCache() : maxBytes(0) {}
+    std::string entryPath(uint64_t key) const;
+    void readIndex();
+    void writeIndex() const;
+    void evict();
+
+    std::string dir;
+    size_t maxBytes;
+    std::vector<std::pair<uint64_t, size_t> > entries; ///< key and file size, oldest first
+    std::mutex lock;
+};
+}
+#endif // LINECACHE_H
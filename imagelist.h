@@ -17,9 +17,9 @@ public:
     void setImage(int index, const QImage &image);
     void setName(int index, const QString &name);
     virtual void remove(int index);
-    QImage getImage(int index) const;
+    virtual QImage getImage(int index) const;
     QString getName(int index) const;
-    void getContent(QList<QPair<QString, QImage> >& listOut) const;
+    virtual void getContent(QList<QPair<QString, QImage> >& listOut) const;
     virtual void setContent(QList<QPair<QString, QImage> >& listIn);
     virtual void moveUp(int index);
     virtual void moveDown(int index);
@@ -0,0 +1,90 @@
+#include "imagelistwithoverlay.h"
+
+ImageListWithOverlay::ImageListWithOverlay(QObject *parent) : ImageList(parent)
+{
+}
+
+void ImageListWithOverlay::clear()
+{
+    QWriteLocker locker(&this->rwLock);
+    this->_overlayData.clear();
+    ImageList::clear();
+}
+
+void ImageListWithOverlay::append(const QString &name, const QImage &image)
+{
+    QWriteLocker locker(&this->rwLock);
+    this->_overlayData.append(QPicture());
+    ImageList::append(name, image);
+}
+
+void ImageListWithOverlay::remove(int index)
+{
+    QWriteLocker locker(&this->rwLock);
+    if (index >= 0 && index < this->_overlayData.size())
+        this->_overlayData.removeAt(index);
+    ImageList::remove(index);
+}
+
+QImage ImageListWithOverlay::getImage(int index) const
+{
+    QReadLocker locker(&this->rwLock);
+    QImage image = ImageList::getImage(index);
+    if (index >= 0 && index < this->_overlayData.size())
+        return render(image, this->_overlayData.at(index));
+    return image;
+}
+
+void ImageListWithOverlay::getContent(QList<QPair<QString, QImage> > &listOut) const
+{
+    QReadLocker locker(&this->rwLock);
+    ImageList::getContent(listOut);
+    for (int i = 0; i < listOut.size() && i < this->_overlayData.size(); ++i)
+        listOut[i].second = render(listOut[i].second, this->_overlayData.at(i));
+}
+
+void ImageListWithOverlay::setContent(QList<QPair<QString, QImage> > &listIn)
+{
+    QList<QPicture> overlayIn;
+    for (int i = 0; i < listIn.size(); ++i)
+        overlayIn.append(QPicture());
+    this->setContent(listIn, overlayIn);
+}
+
+void ImageListWithOverlay::setContent(QList<QPair<QString, QImage> > &listIn,
+                                      QList<QPicture> &overlayIn)
+{
+    Q_ASSERT(listIn.size() == overlayIn.size());
+    QWriteLocker locker(&this->rwLock);
+    this->_overlayData = overlayIn;
+    ImageList::setContent(listIn);
+}
+
+void ImageListWithOverlay::moveUp(int index)
+{
+    QWriteLocker locker(&this->rwLock);
+    if (index >= 1 && index < this->_overlayData.size())
+        this->_overlayData.swap(index, index-1);
+    ImageList::moveUp(index);
+}
+
+void ImageListWithOverlay::moveDown(int index)
+{
+    QWriteLocker locker(&this->rwLock);
+    if (index >= 0 && index < this->_overlayData.size()-1)
+        this->_overlayData.swap(index, index+1);
+    ImageList::moveDown(index);
+}
+
+QImage ImageListWithOverlay::render(const QImage &image, const QPicture &overlay)
+{
+    if (image.isNull() || overlay.isNull())
+        return image;
+    QImage out = image.convertToFormat(QImage::Format_RGB32);
+    if (out.isNull())
+        return image;
+    QPainter painter(&out);
+    painter.setRenderHint(QPainter::Antialiasing);
+    painter.drawPicture(0, 0, overlay);
+    return out;
+}
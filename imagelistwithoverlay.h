@@ -0,0 +1,29 @@
+#ifndef IMAGELISTWITHOVERLAY_H
+#define IMAGELISTWITHOVERLAY_H
+#include "imagelist.h"
+#include <QtCore>
+#include <QtGui>
+
+/* Image list whose images carry a vector overlay (detected circles, lines...). The overlay is
+ * only painted over a copy of the image when the image is asked for, i.e. when it is displayed
+ * or saved, so solvers producing feedback don't pay for the drawing. */
+class ImageListWithOverlay : public ImageList
+{
+    Q_OBJECT
+public:
+    ImageListWithOverlay(QObject *parent = 0);
+    void clear();
+    void append(const QString &name, const QImage &image);
+    void remove(int index);
+    QImage getImage(int index) const;
+    void getContent(QList<QPair<QString, QImage> > &listOut) const;
+    void setContent(QList<QPair<QString, QImage> > &listIn);
+    void setContent(QList<QPair<QString, QImage> > &listIn, QList<QPicture> &overlayIn);
+    void moveUp(int index);
+    void moveDown(int index);
+private:
+    static QImage render(const QImage &image, const QPicture &overlay);
+    QList<QPicture> _overlayData;
+};
+
+#endif // IMAGELISTWITHOVERLAY_H
@@ -4,6 +4,7 @@
 #include <vector>
 #include <cmath>
 #include <algorithm>
+#include <stdint.h>
 /** Image data type
  *
  */
@@ -118,6 +119,113 @@ private:
     std::vector<T> _data;
     unsigned int _xsize, _ysize;
 };
+
+/** Read-only view of the xsize*ysize rectangle at (x0, y0) of an image, without copy.
+ *  Pixels of the rectangle lying outside of the image read as outsideValue.
+ */
+template<typename T>
+class ImageGrayView
+{
+public:
+    ImageGrayView(const ImageGray<T> &img, int x0, int y0, int xsize, int ysize, T outsideValue) :
+        _img(&img), _x0(x0), _y0(y0), _xsize(xsize), _ysize(ysize), _outside(outsideValue)
+    {
+        if (xsize <= 0 || ysize <= 0)
+            libMsg::error("Invalid Image Size, xsize==0 or ysize==0");
+        _inside = img.pixelInside(x0, y0) && img.pixelInside(x0+xsize-1, y0+ysize-1);
+    }
+
+    bool pixelInside(int x, int y)const
+    {
+        return 0 <= x && x < this->_xsize && 0 <= y && y < this->_ysize;
+    }
+
+    inline const T &pixel(int x, int y) const
+    {
+        if (_inside || _img->pixelInside(x+_x0, y+_y0))
+            return _img->pixel(x+_x0, y+_y0);
+        return _outside;
+    }
+
+    inline int xsize() const
+    {
+        return _xsize;
+    }
+
+    inline int ysize() const
+    {
+        return _ysize;
+    }
+
+private:
+    const ImageGray<T> *_img;
+    int _x0, _y0, _xsize, _ysize;
+    bool _inside;
+    T _outside;
+};
+
+/** Binary image packed 64 pixels per word: pixel (x,y) is the bit x%64 of the word x/64 of
+ *  row y. The bits past xsize in the last word of a row stay 0.
+ */
+class ImageBit
+{
+public:
+    ImageBit() : _xsize(0),
+        _ysize(0),
+        _stride(0)
+    {
+    }
+
+    // all the pixels are cleared
+    void resize(unsigned int xsize, unsigned int ysize)
+    {
+        if (xsize == 0 || ysize == 0)
+            libMsg::error("Invalid Image Size, xsize==0 or ysize==0");
+        this->_stride = (xsize+63)/64;
+        try{
+            _data.assign(this->_stride*ysize, 0);
+        }catch (std::bad_alloc &bad) {
+            libMsg::error("Not enough memory for resizing ImageBit");
+        }
+        this->_xsize = xsize;
+        this->_ysize = ysize;
+    }
+
+    bool pixelInside(int x, int y)const
+    {
+        return 0 <= x && x < this->_xsize && 0 <= y && y < this->_ysize;
+    }
+
+    inline bool pixel(int x, int y) const
+    {
+        return (_data[(x>>6)+y*this->_stride] >> (x&63)) & 1;
+    }
+
+    inline uint64_t *row(int y)
+    {
+        return &_data[y*this->_stride];
+    }
+
+    inline const uint64_t *row(int y) const
+    {
+        return &_data[y*this->_stride];
+    }
+
+    inline int xsize() const
+    {
+        return _xsize;
+    }
+
+    inline int ysize() const
+    {
+        return _ysize;
+    }
+
+private:
+    std::vector<uint64_t> _data;
+    unsigned int _xsize, _ysize, _stride;
+};
+
 template<typename T>
 class ImageRGB
 {
@@ -4,6 +4,7 @@ namespace libMsg {
 Messager *globalMessager = 0;
 ostream cout(globalMessager);//Use globalMessage as standard output
 AbortFlag abortFlag;
+static thread_local std::stringstream *threadCapture = 0;
 
 void error(const char *msg)
 {
@@ -23,8 +24,14 @@ ostream &ostream::operator<<(ostream & (*manipFunc)(ostream &))
     return (*manipFunc)(*this);
 }
 
+std::stringstream &ostream::stream()
+{
+    return threadCapture ? *threadCapture : ss;
+}
+
 ostream &ostream::flush()
 {
+    if (threadCapture) return *this;
     if (this->receiverMsg) {
         this->receiverMsg->message(ss.str(), M_TEXT);
         ss.str(std::string());
@@ -35,14 +42,14 @@ ostream &ostream::flush()
 
 ostream &ostream::endl()
 {
-    ss.put('\n');
+    stream().put('\n');
     return this->flush();
 }
 
 ostream &ostream::setprecision(int precision)
 {
     this->doublePrecision = precision > 2 ? precision : 2;
-    ss.precision(doublePrecision);
+    stream().precision(doublePrecision);
 	return *this;
 }
 
@@ -56,6 +63,18 @@ ostream &endl(ostream &os)
     return os.endl();
 }
 
+CaptureScope::CaptureScope(std::string &log) : log(log), previous(threadCapture)
+{
+    buffer.precision(cout.doublePrecision);
+    threadCapture = &buffer;
+}
+
+CaptureScope::~CaptureScope()
+{
+    threadCapture = previous;
+    log += buffer.str();
+}
+
 void abortIfAsked()
 {
     if(abortFlag.abortRequested()){
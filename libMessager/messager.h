@@ -34,17 +34,33 @@ class ostream
 public:
     ostream(Messager * &msg);
     template<typename T>
-    ostream& operator<<(const T& value) { ss<<value; return *this; }
+    ostream& operator<<(const T& value) { stream()<<value; return *this; }
     ostream &operator<<(ostream & (*manipFunc)(ostream &));
     ostream &flush();
     ostream &endl();
     ostream &setprecision(int precision);
 private:
+    friend class CaptureScope;
+    std::stringstream &stream();
     Messager * &receiverMsg;
     std::stringstream ss;
     int doublePrecision;
 };
 
+/* While alive, what the calling thread writes to libMsg::cout is appended to log instead of
+   being sent to the Messager, so a task run on a thread pool can have its messages printed
+   in order once it is done */
+class CaptureScope
+{
+public:
+    CaptureScope(std::string &log);
+    ~CaptureScope();
+private:
+    std::string &log;
+    std::stringstream buffer;
+    std::stringstream *previous;
+};
+
 ostream &flush(ostream &os);
 ostream &endl(ostream &os);
 extern ostream cout;
@@ -1,6 +1,7 @@
 #include "mainwindow.h"
 #include "sciencedoubledelegate.h"
 #include "imagelistwithpoint2d.h"
+#include "imagelistwithoverlay.h"
 #include <QtWidgets>
 #include <QPushButton>
 #include <QtConcurrent>
@@ -26,8 +27,8 @@ MainWindow::MainWindow(QWidget *parent) :
     this->solver->registerModels(photoModel->core(), photoCircleModel->core(),
                                  photoHarpModel->core(), this->imagePoint2DCore,
                                  undistortedCircleModel->core(), undistortedHarpModel->core(),
-                                 harpFeedbackModel->core(),
-                                 circleFeedbackModel->core(), distModel->core(),
+                                 this->harpFeedbackCore,
+                                 this->circleFeedbackCore, distModel->core(),
                                  kModel->core(), point3DModel->core(),
                                  camPosModel->core(), camCompareModel->core(), this);
 
@@ -96,6 +97,10 @@ void MainWindow::setupPhotoModels()
 
     this->imagePoint2DCore = new ImageListWithPoint2D(this);
     undistortedPhotoModel->setCoreData(this->imagePoint2DCore);
+    this->circleFeedbackCore = new ImageListWithOverlay(this);
+    circleFeedbackModel->setCoreData(this->circleFeedbackCore);
+    this->harpFeedbackCore = new ImageListWithOverlay(this);
+    harpFeedbackModel->setCoreData(this->harpFeedbackCore);
 }
 
 void MainWindow::setupPointModels()
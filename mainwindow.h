@@ -56,6 +56,8 @@ private:
     ImageListModel *undistortedHarpModel;
 
     ImageListWithPoint2D *imagePoint2DCore;
+    ImageListWithOverlay *circleFeedbackCore;
+    ImageListWithOverlay *harpFeedbackCore;
 
     MarkerImageView *markerViewer;
     ImageViewer *imageViewer;
@@ -118,7 +118,7 @@ static void polynome2DistortionValue(DistortionValue &distValue,
     }
 }
 
-static bool distortionFromImages(ImageList *imageList, ImageList *feedbackList,
+static bool distortionFromImages(ImageList *imageList, ImageListWithOverlay *feedbackList,
                                  DistortionValue &out)
 {
     QList<QPair<QString, QImage> > snapshot;
@@ -129,6 +129,22 @@ static bool distortionFromImages(ImageList *imageList, ImageList *feedbackList,
         QImage2ImageByte(snapshot[i].second, byteImageList[i]);
 
     libMsg::abortIfAsked();
+    // lines already detected in an image are reloaded from this cache
+    QSettings settings;
+    QString cacheDir = settings.value("line_cache_dir", QStandardPaths::writableLocation(
+                                          QStandardPaths::CacheLocation)+"/lines").toString();
+    qint64 cacheMaxMB = settings.value("line_cache_max_mb", 64).toLongLong();
+    if (!cacheDir.isEmpty() && !QDir().mkpath(cacheDir))
+        cacheDir.clear();
+    DistortionModule::setLineCache(cacheDir.toLocal8Bit().toStdString(),
+                                   static_cast<size_t>(cacheMaxMB) << 20);
+    // an aborted estimation on the same images resumes from this file
+    QString checkpoint = settings.value("distortion_checkpoint", QStandardPaths::writableLocation(
+                                            QStandardPaths::CacheLocation)+"/distortion.ckpt").toString();
+    if (!checkpoint.isEmpty() && !QDir().mkpath(QFileInfo(checkpoint).absolutePath()))
+        checkpoint.clear();
+    DistortionModule::setCheckpoint(checkpoint.toLocal8Bit().toStdString());
+
     std::vector<double> polynome;
     int order = 11;
     std::vector<std::vector<std::vector<std::pair<double, double> > > > detectedLines;
@@ -137,12 +153,13 @@ static bool distortionFromImages(ImageList *imageList, ImageList *feedbackList,
     PolyOrderConvert_Lib2Qt(polynome, order);
     polynome2DistortionValue(out, polynome, order);
 
+    // the detected lines are painted over the harp images only when the feedback is shown
     QList<QPair<QString, QImage> > feedback;
+    QList<QPicture> overlay;
     for (int i = 0; i < snapshot.size(); ++i) {
         QString name = snapshot[i].first+" Feedback";
-        QImage image = snapshot[i].second.convertToFormat(QImage::Format_RGB32);
-        checkQImageMemory(image);
-        QPainter painter(&image);
+        QPicture picture;
+        QPainter painter(&picture);
         painter.setRenderHint(QPainter::Antialiasing);
         std::vector<std::vector<std::pair<double, double> > > &lines = detectedLines[i];
         for (int j = 0; j < lines.size(); ++j) {
@@ -162,10 +179,11 @@ static bool distortionFromImages(ImageList *imageList, ImageList *feedbackList,
                 y1 = y2;
             }
         }
-        feedback.append(qMakePair(name, image));
+        painter.end();
+        feedback.append(qMakePair(name, snapshot[i].second));
+        overlay.append(picture);
     }
-    feedbackList->clear();
-    feedbackList->setContent(feedback);
+    feedbackList->setContent(feedback, overlay);
     return true;
 }
 
@@ -205,7 +223,7 @@ static bool correctDistortion(const QImage &imageIn, QImage &out, Distortion *di
     return true;
 }
 
-static bool calculateKFromImages(ImageList *circlePhotoList, ImageList *feedbackList,
+static bool calculateKFromImages(ImageList *circlePhotoList, ImageListWithOverlay *feedbackList,
                                  KValue &kValue)
 {
     QList<QPair<QString, QImage> > snapshot;
@@ -213,18 +231,21 @@ static bool calculateKFromImages(ImageList *circlePhotoList, ImageList *feedback
     if (snapshot.size() == 0) return false;
     std::vector<QImage> stdImageList;
     std::vector<QImage> feedback;
+    std::vector<QPicture> overlay;
     for (int i = 0; i < snapshot.size(); ++i)
         stdImageList.push_back(snapshot[i].second);
     double alpha, beta, u0, v0, gamma;
 
-    bool ok = KMatrixSolve::KMatrixSolver(stdImageList, feedback, alpha, beta, u0, v0, gamma, 3.0,
-                                          1.0);
+    bool ok = KMatrixSolve::KMatrixSolver(stdImageList, feedback, overlay, alpha, beta, u0, v0,
+                                          gamma, 3.0, 1.0);
 
     QList<QPair<QString, QImage> > tempFeedback;
-    for (int i = 0; i < feedback.size(); ++i)
+    QList<QPicture> tempOverlay;
+    for (int i = 0; i < feedback.size(); ++i) {
         tempFeedback.push_back(qMakePair(QString("Feedback_%1").arg(1+i), feedback[i]));
-    feedbackList->clear();
-    feedbackList->setContent(tempFeedback);
+        tempOverlay.push_back(overlay[i]);
+    }
+    feedbackList->setContent(tempFeedback, tempOverlay);
 
     if (!ok) return false;
     kValue = {alpha, beta, u0, v0, gamma };
@@ -234,7 +255,8 @@ static bool calculateKFromImages(ImageList *circlePhotoList, ImageList *feedback
 void Solver::registerModels(ImageList *photoList, ImageList *circleList, ImageList *harpList,
                             ImageListWithPoint2D *undistortedPhotoPoint2DList,
                             ImageList *undistortedCircleList, ImageList *undistortedHarpList,
-                            ImageList *harpFeedbackList, ImageList *circleFeedbackList,
+                            ImageListWithOverlay *harpFeedbackList,
+                            ImageListWithOverlay *circleFeedbackList,
                             Distortion *distortion, KMatrix *kMatrix, Point3D *point3D,
                             CameraPos *camPos,CameraPos *camCompare, libMsg::Messager *messager)
 {
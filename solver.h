@@ -3,6 +3,7 @@
 
 #include "imagelist.h"
 #include "imagelistwithpoint2d.h"
+#include "imagelistwithoverlay.h"
 #include "distortion.h"
 #include "kmatrix.h"
 #include "point3d.h"
@@ -18,8 +19,8 @@ public:
     explicit Solver(QObject *parent = 0);
     void registerModels(ImageList *photoList, ImageList *circleList, ImageList *harpList,
                         ImageListWithPoint2D *undistortedPhotoPoint2DList, ImageList *undistortedCircleList,
-                        ImageList *undistortedHarpList, ImageList *harpFeedbackList,
-                        ImageList *circleFeedbackList, Distortion *distortion,
+                        ImageList *undistortedHarpList, ImageListWithOverlay *harpFeedbackList,
+                        ImageListWithOverlay *circleFeedbackList, Distortion *distortion,
                         KMatrix *kMatrix, Point3D *point3D, CameraPos *camPos, CameraPos *camCompare,
                         libMsg::Messager *messager = 0);
 
@@ -52,8 +53,8 @@ private:
     ImageListWithPoint2D *undistortedPhotoPoint2DList;
     ImageList *undistortedCircleList;
     ImageList *undistortedHarpList;
-    ImageList *harpFeedbackList;
-    ImageList *circleFeedbackList;
+    ImageListWithOverlay *harpFeedbackList;
+    ImageListWithOverlay *circleFeedbackList;
     Distortion *distortion;
     KMatrix *kMatrix;
     Point3D *point3D;